@@ -0,0 +1,84 @@
+//
+//  bench.c
+//
+//  Copyright © 2020 by Blockchain Commons, LLC
+//  Licensed under the "BSD-2-Clause Plus Patent License"
+//
+//  Counts CPU cycles with Timer1 running at the system clock, and reports the
+//  averages over USART0, which simavr echoes to its console.
+//
+
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include <avr/sleep.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bip39.h"
+
+static volatile uint16_t timer_overflows;
+
+ISR(TIMER1_OVF_vect) { timer_overflows++; }
+
+static uint32_t cycles() {
+    uint8_t sreg = SREG;
+    cli();
+    uint16_t lo = TCNT1;
+    uint16_t hi = timer_overflows;
+    if ((TIFR1 & _BV(TOV1)) && lo < 0x8000) {
+        hi++;
+    }
+    SREG = sreg;
+    return ((uint32_t)hi << 16) | lo;
+}
+
+static int uart_putchar(char c, FILE* stream) {
+    loop_until_bit_is_set(UCSR0A, UDRE0);
+    UDR0 = c;
+    return 0;
+}
+
+static FILE uart_stdout = FDEV_SETUP_STREAM(uart_putchar, NULL, _FDEV_SETUP_WRITE);
+
+int main() {
+    UCSR0B = _BV(TXEN0);
+    stdout = &uart_stdout;
+
+    TCCR1A = 0;
+    TCCR1B = _BV(CS10);
+    TIMSK1 = _BV(TOIE1);
+    sei();
+
+    void* ctx = bip39_new_context();
+    char mnemonic[9];
+
+    uint32_t get_mnemonic_cycles = 0;
+    uint32_t word_from_mnemonic_cycles = 0;
+    uint16_t errors = 0;
+
+    for (uint16_t w = 0; w < 2048; w++) {
+        uint32_t start = cycles();
+        const char* s = bip39_get_mnemonic(ctx, w);
+        get_mnemonic_cycles += cycles() - start;
+        strcpy(mnemonic, s);
+
+        start = cycles();
+        int16_t r = bip39_word_from_mnemonic(mnemonic);
+        word_from_mnemonic_cycles += cycles() - start;
+        if (r != w) {
+            errors++;
+        }
+    }
+
+    bip39_dispose_context(ctx);
+
+    printf("bip39_get_mnemonic: %lu cycles/call\n", get_mnemonic_cycles / 2048);
+    printf("bip39_word_from_mnemonic: %lu cycles/call\n", word_from_mnemonic_cycles / 2048);
+    printf("errors: %u\n", errors);
+
+    // simavr exits when the core sleeps with interrupts disabled.
+    cli();
+    sleep_enable();
+    sleep_cpu();
+    return 0;
+}
@@ -0,0 +1,452 @@
+#include "abbrev.h"
+
+const uint16_t bip39_abbrev_displacements[BIP39_ABBREV_BUCKETS] PROGMEM = {
+    0,    1,    0,    14,   0,    0,    0,    0,    0,    1,
+    35,   5,    0,    0,    1,    24,   3,    6,    4,    0,
+    8,    1,    4,    0,    32,   0,    1,    6,    1,    0,
+    0,    1,    2,    0,    34,   3,    0,    2,    5,    5,
+    24,   0,    0,    98,   0,    0,    0,    2,    3,    8,
+    16,   1,    0,    2,    13,   3,    0,    0,    6,    0,
+    5,    1,    18,   1,    3,    23,   0,    2,    9,    0,
+    0,    1,    0,    2,    9,    14,   67,   0,    3,    2,
+    3,    0,    1,    0,    1,    1,    4,    4,    1,    3,
+    0,    0,    0,    0,    6,    0,    2,    0,    16,   2,
+    0,    21,   169,  12,   32,   22,   34,   6,    16,   0,
+    1,    1,    0,    21,   3,    8,    0,    0,    16,   32,
+    159,  7,    0,    13,   2,    1,    10,   0,    0,    5,
+    38,   6,    0,    88,   0,    0,    2,    1,    0,    2,
+    5,    45,   3,    22,   37,   0,    6,    0,    25,   17,
+    2,    0,    0,    2,    2,    20,   1,    7,    10,   256,
+    16,   0,    1,    35,   0,    0,    72,   0,    2,    0,
+    19,   2,    1,    0,    0,    1,    3,    3,    6,    15,
+    0,    2,    1,    1,    1,    0,    7,    3,    1,    3,
+    0,    35,   5,    274,  6,    7,    0,    14,   0,    0,
+    0,    0,    1,    1,    7,    0,    25,   0,    0,    8,
+    0,    0,    3,    0,    5,    15,   17,   3,    0,    0,
+    13,   0,    0,    7,    2,    0,    2,    0,    0,    5,
+    6,    0,    0,    2,    3,    6,    0,    10,   22,   0,
+    6,    0,    4,    39,   0,    8,    2,    1,    3,    5,
+    32,   33,   0,    16,   34,   2,    2,    18,   349,  4,
+    2,    1,    7,    0,    26,   0,    5,    32,   33,   0,
+    64,   3,    0,    0,    0,    2,    49,   19,   14,   3,
+    4,    0,    0,    6,    1,    0,    0,    284,  0,    17,
+    0,    3,    0,    0,    27,   5,    0,    7,    13,   0,
+    1,    42,   24,   0,    1,    5,    25,   0,    64,   3,
+    0,    0,    11,   2,    4,    0,    8,    316,  0,    36,
+    26,   1,    1,    5,    0,    1,    0,    0,    8,    1,
+    0,    0,    5,    10,   0,    10,   2,    0,    3,    125,
+    0,    13,   13,   1,    0,    68,   3,    6,    35,   1,
+    4,    9,    1,    2,    1,    1,    0,    4,    0,    0,
+    5,    0,    84,   6,    10,   18,   17,   0,    3,    0,
+    512,  3,    0,    3,    4,    23,   6,    41,   13,   7,
+    27,   1,    3,    534,  0,    0,    29,   3,    2,    2,
+    0,    2,    10,   8,    4,    2,    33,   5,    1,    0,
+    1,    0,    1,    32,   73,   24,   5,    2,    0,    70,
+    1,    40,   1,    7,    52,   0,    1,    0,    2,    81,
+    4,    18,   86,   10,   3,    2,    0,    49,   2,    14,
+    0,    10,   6,    11,   1,    3,    1,    28,   2,    32,
+    512,  39,   514,  26,   11,   0,    0,    552,  0,    3,
+    0,    2,    7,    565,  29,   27,   24,   41,   0,    0,
+    0,    4,    0,    0,    58,   4,    513,  0,    17,   18,
+    0,    11,   10,   1,    25,   18,   6,    0,    0,    0,
+    0,    23,   10,   0,    24,   88,   1,    9,    0,    3,
+    33,   0,    10,   0,    0,    516,  7,    0,    530,  5,
+    33,   25,   1,    5,    70,   0,    12,   1,    1,    562,
+    31,   66,   1,    2,    14,   1,    515,  58,   1,    576,
+    0,    68,   3,    1,    64,   1,    4,    0,    1,    5,
+    0,    56,   3,    2,    4,    147,  88,   0,    0,    513,
+    0,    3,    53,   18,   590,  8,    515,  48,   13,   9,
+    2,    1,    2,    4,    549,  3,    1,    5,    0,    3,
+    3,    15,   18,   6,    0,    7,    1,    19,   8,    544,
+    28,   5,    103,  0,    19,   17,   18,   577,  3,    0,
+    3,    3,    49,   0,    102,  14,   0,    10,   0,    5,
+    0,    0,    48,   8,    38,   2,    0,    3,    10,   13,
+    1,    0,    512,  0,    37,   549,  140,  13,   4,    0,
+    2,    14,   68,   4,    0,    0,    2,    9,    0,    0,
+    17,   0,    1,    77,   33,   2,    0,    0,    2,    178,
+    5,    6,    3,    0,    0,    25,   0,    0,    35,   7,
+    15,   4,    70,   12,   0,    0,    1,    0,    0,    10,
+    1,    1,    0,    0,    24,   34,   12,   0,    0,    3,
+    10,   5,    0,    31,   16,   79,   0,    1,    24,   1,
+    25,   6,    37,   6,    2,    2,    0,    789,  1,    7,
+    8,    7,    1,    0,    22,   810,  112,  18,   29,   4,
+    580,  0,    0,    120,  18,   11,   1,    518,  0,    21,
+    782,  0,    4,    24,   14,   6,    3,    9,    20,   8,
+    0,    0,    65,   850,  1,    1,    0,    9,    6,    3,
+    0,    14,   332,  0,    0,    89,   112,  7,    0,    1,
+    0,    0,    980,  2,    0,    404,  3,    28,   9,    0,
+    20,   53,   21,   549,  0,    12,   16,   27,   1,    54,
+    0,    12,   23,   10,   35,   14,   15,   48,   0,    2,
+    294,  1044, 1,    0,    0,    9,    0,    16,   1,    12,
+    1,    0,    0,    4,    1043, 20,   1,    33,   3,    5,
+    14,   111,  0,    15,   75,   1029, 9,    38,   27,   128,
+    1152, 5,    226,  56,   29,   15,   11,   1074, 90,   0,
+    19,   48,   8,    1040, 32,   1042, 0,    3,    0,    1164,
+    35,   8,    17,   0,    1032, 0,    73,   0,    166,  0,
+    90,   72,   37,   165,  11,   0,    76,   17,   1025, 32,
+    1025, 3,    93,   7,    95,   4,    32,   1,    8,    0,
+    3,    1028, 13,   16,   330,  0,    0,    0,    0,    1032,
+    4,    0,    1,    1081, 64,   4,    15,   0,    1,    1028,
+    7,    169,  1225, 10,   1061, 8,    52,   12,   28,   0,
+    7,    22,   0,    95,   12,   1279, 15,   49,   1,    0,
+    1191, 9,    40,   120,  15,   158,  9,    1032, 67,   4,
+    26,   0,    6,    0,    20,   5,    4,    0,    3,    2,
+    10,   1226, 17,   7,    1142, 0,    1052, 10,   15,   20,
+    28,   40,   0,    258,  154,  1219, 0,    1,    1,    96,
+    4,    1028, 0,    7,    3,    7,    16,   1234, 3,    1,
+    0,    1,    0,    19,   64,   1,    53,   19,   26,   0,
+    5,    0,    32,   106,  6,    28,   141,  3,    44,   0,
+    42,   16,   165,  59,   1224, 522,  5,    1057, 0,    6,
+    1408, 1375, 36,   0,    49,   0,    0,    1024, 72,   53,
+    1,    14,   59,   339,  152,  0,    20,   33,   8,    32,
+    10,   706,  1071, 1027, 0,    78,   138,  23,   1544, 1567,
+    124,  32,   1124, 1665, 19,   1229, 1666, 131,  764,  13,
+    0,    1730, 0,    1246, 5,    0,    0,    1697, 161,  16,
+    3,    10,   1,    3,    2,    576,  1609, 18,   1901, 0,
+    528,  535,  0,    2,
+};
+
+const uint32_t bip39_abbrev_slots[BIP39_ABBREV_SLOTS] PROGMEM = {
+    0x0C205227, 0x1B4C93DA, 0x280FFD4E, 0x2F7E16B9, 0x2FBFFEE2, 0x2CA795E3,
+    0x2BC3C5C2, 0x0E2E6A7E, 0x28184D5B, 0x15E86B81, 0x2E2A3E24, 0x0F840AC8,
+    0x363C07AD, 0x1CFCF3EA, 0x0C29D229, 0x2818E566, 0x067500E3, 0x33E7F775,
+    0x30DDCF0D, 0x1CFFEBF1, 0x0E33C281, 0x1498BB64, 0x2F0C467B, 0x0D1D1240,
+    0x2F8B26C6, 0x1CFF53EF, 0x1FBA9C59, 0x2E2B6E25, 0x2472C4C9, 0x0EE77AA7,
+    0x03829833, 0x2BB46D9D, 0x31F82753, 0x02CB501C, 0x2DC85DF6, 0x35ABEF9C,
+    0x37FE37D2, 0x10F29AF7, 0x1BB9BBDE, 0x2F92DECD, 0x03803832, 0x1234A324,
+    0x20155C68, 0x201DAC71, 0x30EA4715, 0x037D4031, 0x037B7830, 0x0EEF32AB,
+    0x1D4D1BFC, 0x03859037, 0x08DCA9A1, 0x38A86FEC, 0x08D0C993, 0x3426E77C,
+    0x2EA63E51, 0x0895816C, 0x0A1089C3, 0x212AF48F, 0x1FBEC45F, 0x2DF8760A,
+    0x37FAA7CD, 0x02D4D01F, 0x089D3989, 0x376667B7, 0x35BBF7A9, 0x2186E494,
+    0x0BA9C225, 0x2F178E86, 0x0403F058, 0x075C611B, 0x27449D25, 0x2F6F569E,
+    0x084E5955, 0x2CAA8DE5, 0x24982CCA, 0x23929CBD, 0x2F06EE75, 0x2699CD0A,
+    0x04F4B896, 0x07FDB145, 0x2813A557, 0x02F4E022, 0x0DAACA65, 0x381AB7D9,
+    0x24481CC2, 0x08587161, 0x08D0498E, 0x07B6892C, 0x1E3CB421, 0x09C371BD,
+    0x075CF91F, 0x2FB41EDA, 0x285B656D, 0x074E20FF, 0x075D9122, 0x2E6A5E37,
+    0x2BC50DC5, 0x1DAD340E, 0x2BC475C4, 0x2BBCBDAD, 0x1CED9BE0, 0x0A1381CB,
+    0x1228DB20, 0x04123067, 0x280C854B, 0x0A6E41ED, 0x23044CAF, 0x0F7D02C1,
+    0x02B2780E, 0x2DC90DF8, 0x0A1BD1D6, 0x0A1C69D9, 0x09C701BF, 0x2ED6EE65,
+    0x2E1D4618, 0x30D3CF0A, 0x0FCD12D6, 0x2E23361B, 0x1DA7DC0B, 0x2866AD77,
+    0x2F808EBD, 0x1FAF6C4E, 0x2E7FBE49, 0x0461107E, 0x16F1A3B0, 0x0A7989F7,
+    0x38EA57F5, 0x3174872E, 0x13AC3353, 0x2E847E4C, 0x0895996D, 0x0EE0B2A4,
+    0x13634B4E, 0x33EE9777, 0x35B8F7A4, 0x1B4BF3D7, 0x21C53C96, 0x308C0EF9,
+    0x0F3E2AB0, 0x1F1E242B, 0x2F9096C9, 0x34449782, 0x31EE2750, 0x27D56541,
+    0x2019046C, 0x10F80AFF, 0x0630E8CC, 0x08904169, 0x02D4501E, 0x257EF4DB,
+    0x0B3E7A18, 0x0EEFE2AC, 0x31733F2B, 0x2DD04DFE, 0x1F691C4C, 0x1CF013E4,
+    0x08E181A7, 0x05E0D8BA, 0x2584E4DC, 0x27418521, 0x37B68FC5, 0x35B58FA1,
+    0x0B4B8A1D, 0x04E7C089, 0x05E3D0BC, 0x14123B5E, 0x0B48921C, 0x089A5982,
+    0x12B4E33B, 0x31AC573F, 0x0D531A5A, 0x089D518B, 0x238CC4BB, 0x12701B32,
+    0x2DCEBDFA, 0x0543189F, 0x13162B40, 0x033F182A, 0x26981D04, 0x26978500,
+    0x3FDA27FE, 0x33B77766, 0x33BC376E, 0x239184BC, 0x381F8FE1, 0x04EF788F,
+    0x26E4DD11, 0x054C00A8, 0x084E7157, 0x2851FD68, 0x30EB8F16, 0x0D43524A,
+    0x3C84AFF7, 0x0550C0AA, 0x03A19041, 0x20959C75, 0x2B5E8588, 0x0758510B,
+    0x0FCACAD5, 0x2B592D83, 0x075BE118, 0x2F0EBE7F, 0x2EBFDE5B, 0x2E69DE33,
+    0x31736F2C, 0x16E1B393, 0x2F7676AF, 0x24A424CD, 0x1D4873F6, 0x2B693593,
+    0x30CC2F05, 0x0405D05B, 0x0FD022DD, 0x2C18C5D0, 0x2BC2C5BF, 0x0A1989D2,
+    0x0A1AB9D4, 0x19ED0BC6, 0x02B3280F, 0x2BB815A5, 0x03AE0848, 0x0E277A73,
+    0x04108063, 0x0A73B1F1, 0x2F7E46BA, 0x30D6470B, 0x0D2DCA43, 0x0E93729F,
+    0x067070E2, 0x2E7EA646, 0x302CA6EA, 0x20153467, 0x08D06190, 0x047D1086,
+    0x119FFB0D, 0x2D2D55EC, 0x0A802A01, 0x1EB66C25, 0x1F5EDC37, 0x0AF54A03,
+    0x1F626C3F, 0x02C6281B, 0x2EB91657, 0x2F8B56C7, 0x0E92429C, 0x0379E02E,
+    0x2E89EE4F, 0x2013C465, 0x2EA98E55, 0x0428406E, 0x37FDCFD0, 0x149E436E,
+    0x1FB1CC53, 0x20158C69, 0x27D7DD44, 0x34F56F83, 0x2EB37E56, 0x21CB449A,
+    0x13B53357, 0x2FF02EE5, 0x0E00626E, 0x25A824E2, 0x075B6114, 0x16EF1BA9,
+    0x2EFF6670, 0x1359DB43, 0x126CA32A, 0x10589AF2, 0x06B718F1, 0x092329AF,
+    0x2F7666AE, 0x37698FB9, 0x16BBCB89, 0x355D3F94, 0x26E4B50F, 0x355F0799,
+    0x25F9DCEA, 0x26549CF3, 0x35B92FA5, 0x2CA26DDE, 0x05ECD0C0, 0x0848014E,
+    0x0AFDF208, 0x0AF80204, 0x084B9154, 0x342A0F7D, 0x2CA7C5E4, 0x2EA2DE50,
+    0x0344882D, 0x33BBB76B, 0x059E88AF, 0x26F09516, 0x0B03E20D, 0x2E5E1627,
+    0x151D3B75, 0x04F45094, 0x244094C0, 0x2093EC73, 0x2EB96E58, 0x0F7D32C2,
+    0x2448E4C4, 0x31BD0F4F, 0x2E61A62B, 0x12791B38, 0x2BB49D9E, 0x25A804E1,
+    0x075A3111, 0x2BB2D597, 0x25516CD6, 0x31BA174C, 0x3175E72F, 0x0759990F,
+    0x2F14C684, 0x2BB82DA6, 0x0DC4826A, 0x3221E75B, 0x20A1947F, 0x2B678591,
+    0x2B60FD8A, 0x2C12EDCF, 0x16E1CB94, 0x280CB54C, 0x0A1871CF, 0x03219829,
+    0x066FF0DD, 0x1FAF9C50, 0x1AF0EBCF, 0x063360CF, 0x2F7DC6B7, 0x089CD187,
+    0x2E79FE41, 0x0FCFA2D9, 0x0E2A8A79, 0x23093CB3, 0x0B85D21F, 0x31B9D74A,
+    0x1F5EF438, 0x092381B1, 0x2E295622, 0x0D2DE244, 0x0F8912CB, 0x30350EF0,
+    0x16F1D3B1, 0x1DAB9C0D, 0x16EEDBA7, 0x1D59C405, 0x27CC1539, 0x308C3EFA,
+    0x04744081, 0x3642D7AF, 0x308BA6F8, 0x303936F3, 0x0421386A, 0x0D39C249,
+    0x0BE1C226, 0x2B69E594, 0x1FBF0C60, 0x2F3BF69C, 0x0B8BC223, 0x38A8B7EF,
+    0x0F43B2B8, 0x2E61662A, 0x3FDAD7FF, 0x2308A4B1, 0x13B67B59, 0x21CAC499,
+    0x33BC0F6C, 0x27845530, 0x3504F78E, 0x11500309, 0x3555078F, 0x16EF73AB,
+    0x0D489A53, 0x11A4D30F, 0x2734DD1C, 0x0D493254, 0x22261CA5, 0x0895C96E,
+    0x08966173, 0x2384A4BA, 0x07ECC12F, 0x14999B68, 0x13B54B58, 0x0D4FBA57,
+    0x12B80B3D, 0x2DCEEDFB, 0x2E7F1647, 0x07F0513B, 0x376A3FBB, 0x2694BCFE,
+    0x07F3493E, 0x0C54DA30, 0x381C2FDC, 0x38205FE2, 0x16D58B8E, 0x1362434D,
+    0x2C96DDD8, 0x0EDEBAA2, 0x074DD0FD, 0x27490D26, 0x0853F95F, 0x0757E908,
+    0x07ECA92E, 0x0B86C220, 0x382187E5, 0x30D37F08, 0x2B595D84, 0x249874CC,
+    0x2CA245DD, 0x055188AB, 0x16D3A38D, 0x0A7939F5, 0x08D0518F, 0x07B17928,
+    0x075B7915, 0x0E2D027B, 0x209E1C79, 0x2F14DE85, 0x209CEC76, 0x3C8DC7F8,
+    0x3170A725, 0x1CF763E6, 0x30C8CF01, 0x2B679D92, 0x31772F31, 0x0E839A8B,
+    0x0DCFE26C, 0x2DC2CDF0, 0x0405685A, 0x0FD0EADF, 0x16E1E395, 0x1FAF1C4D,
+    0x06B1D8ED, 0x2C1ABDD2, 0x2F7B7EB1, 0x2C1D1DD3, 0x0E2E327D, 0x0A1E79DD,
+    0x0A75A9F2, 0x19F163C8, 0x054A80A5, 0x30810EF5, 0x2F228697, 0x1B4703D4,
+    0x1CFE83EE, 0x2B65D590, 0x16F023AE, 0x2F1A368B, 0x0541989D, 0x067560E6,
+    0x1DAF4411, 0x221B84A0, 0x1F5F0C39, 0x2E855E4D, 0x1DB2D413, 0x1E3D9423,
+    0x257B94D9, 0x1011E2EB, 0x062550C5, 0x196EF3C3, 0x27D1853C, 0x2EDBF666,
+    0x2C122DCD, 0x1CEF6BE3, 0x1BB4C3DD, 0x2F9176CB, 0x10F392F9, 0x38A837EB,
+    0x0D98C261, 0x339F6761, 0x02CD781D, 0x2019E46E, 0x2F074E76, 0x10F5F2FA,
+    0x0B8C7224, 0x0D435A4B, 0x2DEC5E00, 0x2783D52E, 0x13ABE351, 0x2015BC6A,
+    0x08967974, 0x07ECD932, 0x05E088B8, 0x0389803B, 0x2DF2E607, 0x2EF31E6C,
+    0x355E9F98, 0x31AC9F40, 0x135ECB48, 0x03E31057, 0x04E77088, 0x089AA183,
+    0x2E5E4628, 0x10553AF1, 0x04920887, 0x269274F9, 0x31AF9741, 0x33BAB76A,
+    0x13AE4354, 0x26943CFB, 0x355A7793, 0x2CA75DE2, 0x2DFA9E0D, 0x0AFF520B,
+    0x2125648B, 0x27492527, 0x0B024A0C, 0x2EA8FE52, 0x31F75752, 0x31BA474D,
+    0x08A0918D, 0x27950D37, 0x09C2A1BC, 0x044C1079, 0x15222B76, 0x2E61D62C,
+    0x1273F335, 0x16D3238C, 0x182CEBBA, 0x0758010A, 0x2E1BDE15, 0x1526EB7D,
+    0x0D194A3C, 0x02A6F809, 0x0A6A79E7, 0x0FCFD2DB, 0x321E8759, 0x3167D71C,
+    0x04045059, 0x2E1D0E17, 0x3EEC9FFC, 0x2E64CE2D, 0x2F72AEA8, 0x09BF11BA,
+    0x2BBF7DB6, 0x2F6FB6A4, 0x06BCA0F7, 0x030B3827, 0x075CC11D, 0x0F7D62C3,
+    0x2F203E92, 0x2E6C8639, 0x2BC30DC0, 0x0E272A72, 0x2E22FE1A, 0x2ED02E63,
+    0x05A4A8B1, 0x10FA6304, 0x2E7E5645, 0x212AEC8E, 0x0428A06F, 0x2F8056BC,
+    0x1F59342E, 0x0E84E28E, 0x1F5AFC31, 0x11E47316, 0x0315E828, 0x1DA39406,
+    0x0A79E9FB, 0x2F83E6BE, 0x0EE0D2A5, 0x188C6BBF, 0x0E8C9A94, 0x37FE17D1,
+    0x0E8DCA98, 0x149F2370, 0x342A3F7F, 0x20A12C7D, 0x1EB9AC26, 0x38A5EFEA,
+    0x2818DD65, 0x2BBC85AB, 0x17A243B7, 0x363987AC, 0x1E36E41E, 0x308F66FB,
+    0x27D82546, 0x27D8BD47, 0x2EBFE65C, 0x27D78D43, 0x0E414A8A, 0x075B5113,
+    0x27848532, 0x201E2472, 0x35AA079A, 0x22251CA3, 0x03831035, 0x27350D1D,
+    0x0B439A1B, 0x0633A8D0, 0x063900D5, 0x0387D039, 0x11ADEB11, 0x0B3AB214,
+    0x12737333, 0x376057B2, 0x212AD48D, 0x07ECF134, 0x063828D4, 0x24E194CE,
+    0x11952B0C, 0x089C8186, 0x0390B83D, 0x07EFE939, 0x273D751F, 0x3D78CFF9,
+    0x1B471BD5, 0x08484951, 0x1E2DBC1B, 0x33B90768, 0x1E2D2419, 0x100C62E7,
+    0x07FB3143, 0x381C5FDE, 0x2B59E585, 0x26427CF2, 0x0456D87C, 0x31B9C749,
+    0x1011BAEA, 0x05F1D8C3, 0x254D94D5, 0x2309F4B4, 0x274C352A, 0x2B5A2586,
+    0x2BB44D9C, 0x1005B2E3, 0x0F4732BA, 0x316FA723, 0x2FB3FED8, 0x2AB83D79,
+    0x08084147, 0x316F0F21, 0x07B7012D, 0x0D170239, 0x30C56EFE, 0x2E7A2E42,
+    0x075C4119, 0x2BBC05AA, 0x2F1AFE8C, 0x2BBC9DAC, 0x1B3EE3D3, 0x363C97AE,
+    0x0F7D7AC5, 0x0E290A76, 0x16F183AF, 0x2E76B63E, 0x1CEE13E2, 0x2E1A2E12,
+    0x2DC985F9, 0x04F6789A, 0x2DC7BDF2, 0x1D4CFBFB, 0x091589AB, 0x38E577F4,
+    0x0669B0D9, 0x06B6C8EF, 0x1DA8540C, 0x1231A322, 0x2BBF95B7, 0x040C205D,
+    0x2E832E4B, 0x2BC455C3, 0x2BC325C1, 0x2E2A3623, 0x091E71AC, 0x0EDDF2A1,
+    0x16E9CBA2, 0x15F14B82, 0x08D3B999, 0x303556F1, 0x02C39018, 0x1D57AC03,
+    0x1F63FC46, 0x2DC855F5, 0x1F678C4B, 0x11F06B1E, 0x38A4D7E8, 0x0B8B7222,
+    0x1FBD8C5B, 0x0A1EA9DF, 0x0B8A4221, 0x1F636443, 0x252414D1, 0x09C519BE,
+    0x27D70D42, 0x2FEBCEE4, 0x0A6E39EC, 0x21C9DC98, 0x21CBA49B, 0x03D50052,
+    0x0F46F2B9, 0x13AC1352, 0x08974179, 0x2F0EDE81, 0x066930D6, 0x273FD520,
+    0x222794A7, 0x1FBA9458, 0x0295F000, 0x2DEC8E02, 0x2F949ED2, 0x37B66FC2,
+    0x10EC0AF5, 0x03E17855, 0x0A1119C6, 0x31AC373E, 0x31B51F47, 0x13BA535A,
+    0x2CA06DDC, 0x0847C94D, 0x0D53925C, 0x31AFC744, 0x376957B8, 0x35B39FA0,
+    0x054720A4, 0x054AB0A6, 0x1365834F, 0x2B61F58B, 0x1518DB74, 0x12BBE33F,
+    0x2F7BC6B5, 0x381C77DF, 0x2F0E9E7D, 0x16EB13A4, 0x28BA4578, 0x04F54898,
+    0x126D032D, 0x03AFB049, 0x089A3981, 0x126FFB31, 0x31650F18, 0x14134B5F,
+    0x20957C74, 0x08590164, 0x316B971E, 0x2E5E7629, 0x06C358FC, 0x2C1055CC,
+    0x04106062, 0x2F6FE6A6, 0x075C591A, 0x2ED05E64, 0x075BC116, 0x209E647B,
+    0x16E19392, 0x1DA4DC09, 0x0D197A3D, 0x1CFA0BE8, 0x3C3777F6, 0x0A6AA9E9,
+    0x31777732, 0x342A6F80, 0x28139D56, 0x31A93F39, 0x075CF11E, 0x2E1F0619,
+    0x28185D5D, 0x36345FAA, 0x2F206E94, 0x06BD68F9, 0x0412C069, 0x0669C8DA,
+    0x3080BEF4, 0x0E292277, 0x230A34B7, 0x0A2121E5, 0x2F7B2EB0, 0x1B4C0BD8,
+    0x1D543402, 0x16EFD3AD, 0x174703B2, 0x123B3B29, 0x34379781, 0x03863838,
+    0x1D012BF2, 0x0C2B122E, 0x135AEB44, 0x0E8CCA95, 0x0C29E22A, 0x1F5ED436,
+    0x0E90F299, 0x1DB4E415, 0x1FB8E455, 0x2FB726DD, 0x1D4A33F8, 0x0478C885,
+    0x33EF2778, 0x0C91B235, 0x08DCB9A2, 0x0428206D, 0x37FDAFCF, 0x2EE6EE69,
+    0x30DE770E, 0x08E179A6, 0x15FFA384, 0x2E72263C, 0x27CBDD38, 0x26994506,
+    0x14094B5B, 0x10F802FE, 0x0D9E6262, 0x05ECB0BF, 0x1E2C2418, 0x242A7CBE,
+    0x2225E4A4, 0x0D9EFA63, 0x10FE8B05, 0x05E0D0B9, 0x08962971, 0x37B687C4,
+    0x18244BB9, 0x16E7039F, 0x04F13892, 0x05E460BD, 0x0D51E258, 0x37C5F7CC,
+    0x084B7153, 0x376A9FBD, 0x089D498A, 0x0390E83E, 0x043FE075, 0x0CA8DA36,
+    0x38156FD7, 0x2741B522, 0x26EF4514, 0x05F170C2, 0x084E6956, 0x1F5F6C3A,
+    0x33B6D764, 0x0343D02C, 0x0D473250, 0x2FB42EDB, 0x2C0BADC6, 0x28603575,
+    0x075B4112, 0x33C51771, 0x1E38041F, 0x2F179E87, 0x255444D8, 0x029EF002,
+    0x0A14C1CE, 0x2E65162F, 0x0C64AA32, 0x30C59EFF, 0x1E36D41D, 0x075D0920,
+    0x2DC165EF, 0x2F0C567C, 0x2BC225BD, 0x07B3A12B, 0x0DC46269, 0x0D18623A,
+    0x0A1131C7, 0x0D19923E, 0x2F6F669F, 0x285F9D73, 0x27554D2D, 0x31719F29,
+    0x06B8C0F3, 0x2F208695, 0x0FD01ADC, 0x2860CD76, 0x2AB86D7B, 0x2DC58DF1,
+    0x040CE860, 0x06BCE8F8, 0x09BE29B8, 0x2AC44D80, 0x06BE18FA, 0x2F7DA6B6,
+    0x1CFB53E9, 0x0E2B027A, 0x0C2A922C, 0x16ECF3A5, 0x2818755F, 0x0A7999F8,
+    0x0923F9B3, 0x09C841C0, 0x2D2865E9, 0x16EF53AA, 0x33E8B776, 0x062810C7,
+    0x0457087D, 0x14A13373, 0x0A1001C2, 0x1498E366, 0x1F5C7434, 0x149B436A,
+    0x1FB99457, 0x149E3B6D, 0x30E5AF10, 0x0E923A9B, 0x25CCB4E7, 0x2013BC64,
+    0x0E91A29A, 0x3226875D, 0x27D44540, 0x08E471A9, 0x2F3BD69B, 0x0B380213,
+    0x2794D536, 0x08E509AA, 0x20187C6B, 0x063060CB, 0x13518341, 0x0F48EABF,
+    0x27DACD4A, 0x0F4392B6, 0x0382C034, 0x063488D1, 0x0F47BABC, 0x066960D7,
+    0x0898097E, 0x03E1A856, 0x09B689B7, 0x0897717B, 0x376007B1, 0x08964172,
+    0x1D588C04, 0x2C984DDB, 0x2E23F61C, 0x13B52B56, 0x269074F8, 0x0B3E8A19,
+    0x2692D4FA, 0x3813BFD5, 0x2DFAFE0E, 0x31AFF745, 0x2EA95E53, 0x381CA7E0,
+    0x33B6EF65, 0x0AFCBA06, 0x0541609C, 0x1E2D6C1A, 0x14167361, 0x100CAAE8,
+    0x0343502B, 0x101202EC, 0x054C10A9, 0x249854CB, 0x31BA0F4B, 0x274AB528,
+    0x1F624C3E, 0x0E05B271, 0x3167071A, 0x243CFCBF, 0x0A0F81C1, 0x2FBACEE0,
+    0x2F0ECE80, 0x07569904, 0x02A20004, 0x25F9D4E9, 0x11EAC318, 0x07573105,
+    0x31711F27, 0x088E8968, 0x12787B36, 0x3172E72A, 0x2553C4D7, 0x254C0CD4,
+    0x0A1149C8, 0x0F3AC2AE, 0x2E6CE63A, 0x1CEDC3E1, 0x19E8F3C5, 0x2F730EAA,
+    0x2BBF45B5, 0x0FD032DE, 0x03AC5046, 0x06B710F0, 0x2C12E5CE, 0x0A6F99EF,
+    0x24482CC3, 0x2C1A05D1, 0x0A1311CA, 0x2F6F7EA1, 0x0A1EF1E1, 0x0DD2226D,
+    0x19F603CB, 0x0E340283, 0x1FAF944F, 0x0EE002A3, 0x2E7E1E43, 0x2E25261F,
+    0x0CD6AA37, 0x0C2A122B, 0x2E7F4E48, 0x0A1DC1DB, 0x03BA9050, 0x1AF50BD0,
+    0x1498FB67, 0x2F87D6C2, 0x262234F0, 0x285DED70, 0x0F41E2B1, 0x1F627C40,
+    0x31770F30, 0x1F63AC45, 0x149F8371, 0x08D7919E, 0x37FAE7CE, 0x2216A49C,
+    0x1FBE6C5E, 0x27D32D3E, 0x0B378210, 0x10F07AF6, 0x15FF3B83, 0x1EBF6428,
+    0x308B9EF7, 0x08E1A9A8, 0x27D1653B, 0x0A79B1F9, 0x0A2151E6, 0x062FE0CA,
+    0x02D51020, 0x28188D60, 0x05E100BB, 0x0A75B1F3, 0x07F8A942, 0x285FB574,
+    0x2DEFCE04, 0x067540E4, 0x2F94E6D3, 0x11AABB10, 0x2185F492, 0x12B17B3A,
+    0x10121AED, 0x31A8EF35, 0x2CA27DDF, 0x05ECE0C1, 0x0D521259, 0x04EAE08C,
+    0x37BD3FC9, 0x2DFA7E0C, 0x0853F15E, 0x31B00F46, 0x02E8A821, 0x0542A89E,
+    0x28134D54, 0x0848114F, 0x0758910D, 0x0545A0A1, 0x26997508, 0x122AE321,
+    0x381C27DB, 0x04F0D091, 0x059E98B0, 0x26F30519, 0x04F46095, 0x31655719,
+    0x285F3571, 0x2C1E45D4, 0x07FD5944, 0x31671F1B, 0x2C1F75D6, 0x080E9148,
+    0x2E75E63D, 0x316D0F1F, 0x0FCFB2DA, 0x2BB70DA1, 0x16D5FB8F, 0x0555A8AE,
+    0x2C0F6DC9, 0x30C8C700, 0x0456A07B, 0x075E6925, 0x0D19C23F, 0x0757E107,
+    0x0D192A3B, 0x25AC3CE4, 0x0FC632D2, 0x2BBD95B1, 0x16E27397, 0x2F143E82,
+    0x2F7326AB, 0x2DC81DF3, 0x06BBE8F4, 0x1D4803F4, 0x2DC8B5F7, 0x0A1AE1D5,
+    0x2BBEC5B3, 0x16E43B9B, 0x2F761EAD, 0x0D250A41, 0x03A8D844, 0x24601CC8,
+    0x16EAC3A3, 0x1E3C5C20, 0x0469087F, 0x02BA7011, 0x092131AD, 0x2818A561,
+    0x11E45315, 0x0D2D5A42, 0x14915B63, 0x067558E5, 0x092391B2, 0x0E341A84,
+    0x22293CA9, 0x0E338280, 0x1FB92C56, 0x067000DF, 0x268BCCF6, 0x0E37AA88,
+    0x1DB82416, 0x149F036F, 0x309076FC, 0x0477E084, 0x380187D3, 0x140BF35C,
+    0x16EFB3AC, 0x20148466, 0x0E8C7A93, 0x2F9336CE, 0x07558102, 0x07522101,
+    0x176C1BB6, 0x381A77D8, 0x08E129A3, 0x381C3FDD, 0x06C1D8FB, 0x0B3EBA1A,
+    0x10F7B2FC, 0x08970978, 0x05E080B7, 0x35AC479D, 0x35AE0F9F, 0x0E296A78,
+    0x0A1161C9, 0x0D4CD256, 0x10F97B02, 0x355A6F92, 0x03E14054, 0x16BB5B87,
+    0x31A90737, 0x212B4C90, 0x07ECD131, 0x376F0FC0, 0x2E784640, 0x04402876,
+    0x07EFC937, 0x063128CD, 0x04EF208D, 0x0D55225E, 0x3769B7BA, 0x1E2BD417,
+    0x10F2F2F8, 0x0C54EA31, 0x30CC5706, 0x11543B0B, 0x376CAFBF, 0x084EB159,
+    0x2BB725A2, 0x26F44D1B, 0x08540960, 0x33BDA76F, 0x382067E3, 0x2BBBE5A9,
+    0x285A8D6B, 0x062560C6, 0x28536D69, 0x2B583D81, 0x2ABF3D7E, 0x0858C962,
+    0x055198AC, 0x135B1B45, 0x0757F909, 0x2BB42D9B, 0x16D61390, 0x075CB91C,
+    0x02A52806, 0x06AE58EA, 0x1AE49BCD, 0x2451F4C6, 0x2F17E689, 0x30E5F711,
+    0x32220F5C, 0x2DC115EE, 0x03AC8047, 0x2F1B7690, 0x2F6FAEA3, 0x2C0F85CA,
+    0x20A41C84, 0x2FBAFEE1, 0x2F7B8EB3, 0x28106D51, 0x16E4539C, 0x0A1A61D3,
+    0x0FD48AE2, 0x03B7304F, 0x040C985F, 0x0F8052C6, 0x06BC00F5, 0x30278EE8,
+    0x36397FAB, 0x2E7E4E44, 0x2305D4B0, 0x244AD4C5, 0x2818BD63, 0x02BC5013,
+    0x0B7DAA1E, 0x0A7C41FF, 0x02B8C010, 0x0F88A2C9, 0x1236DB25, 0x08D0A192,
+    0x0E343285, 0x2EC57660, 0x0FC18AD0, 0x1F60E43C, 0x149C236B, 0x0E8D2A96,
+    0x1F647449, 0x1D4F3BFD, 0x2813FD5A, 0x1FB18C52, 0x37B64FC1, 0x21C7F497,
+    0x0B3E3A16, 0x0E92829E, 0x16E7E3A1, 0x2F9516D5, 0x0B37B211, 0x08DC819F,
+    0x10F99303, 0x0B3B4215, 0x38019FD4, 0x0D45CA4C, 0x088C7166, 0x11A4630E,
+    0x10F8FB01, 0x2DEC6E01, 0x2EBC8E59, 0x063568D2, 0x19661BC2, 0x376AFFBE,
+    0x13B27B55, 0x0D53725B, 0x16D03B8B, 0x0388F83A, 0x26E45D0E, 0x08D39997,
+    0x104D92EF, 0x268E5CF7, 0x135EDB49, 0x0892F96A, 0x1CF7F3E7, 0x376477B5,
+    0x33B4D762, 0x0759D910, 0x31AFA743, 0x35B96FA6, 0x2EFDDE6D, 0x100962E5,
+    0x3502578C, 0x27447524, 0x3410C77A, 0x35BA07A8, 0x26F16D17, 0x2F088E79,
+    0x269DCD0D, 0x2F06C674, 0x187A13BC, 0x37C5BFCB, 0x0853895C, 0x0758A90E,
+    0x0E00A26F, 0x38207FE4, 0x04492878, 0x039C9040, 0x3169AF1D, 0x02F55023,
+    0x0551B0AD, 0x0E28EA74, 0x04F52897, 0x1526FB7E, 0x0C66D233, 0x03A74042,
+    0x16D62B91, 0x33C6A773, 0x2E6A3635, 0x285AA56C, 0x285BD56E, 0x2BBA35A7,
+    0x32218F5A, 0x2C0E6DC7, 0x2EC58E61, 0x285F6572, 0x2E1A2611, 0x2E198E0F,
+    0x20A4CC87, 0x04693880, 0x16E763A0, 0x2BC1EDBB, 0x280FED4D, 0x38E56FF3,
+    0x2D21A5E7, 0x0A1C41D8, 0x1D4CF3FA, 0x2D1FDDE6, 0x0E290275, 0x230A14B5,
+    0x2E6EF63B, 0x04120866, 0x2818D564, 0x092459B4, 0x230C74B9, 0x16E2A398,
+    0x0F910ACF, 0x075E0123, 0x066CA0DC, 0x1CFE13ED, 0x303256EE, 0x0E8C1292,
+    0x0E344A86, 0x149A7369, 0x0E8D4297, 0x08D3B198, 0x0E374287, 0x08D4499A,
+    0x1F62C442, 0x06B888F2, 0x1BB15BDC, 0x0E9462A0, 0x2F919ECC, 0x30E86F14,
+    0x2F9106CA, 0x0A18B1D0, 0x040E7861, 0x037AD02F, 0x2F9496D1, 0x0428006C,
+    0x088BF165, 0x2F7BA6B4, 0x0A1949D1, 0x2019746D, 0x0CE1A238, 0x31F48751,
+    0x114FAB07, 0x11F0631D, 0x34FEAF89, 0x0F8952CC, 0x25D8F4E8, 0x10F87B00,
+    0x1054CAF0, 0x0AFD1A07, 0x269464FD, 0x37622FB3, 0x07ED0136, 0x12B84B3E,
+    0x0899017F, 0x3255375F, 0x14104B5D, 0x0896096F, 0x0A10F9C5, 0x1058F2F3,
+    0x089D2988, 0x35B8EFA3, 0x37BF4FCA, 0x2EFF266E, 0x209D1477, 0x07F38940,
+    0x221D74A1, 0x043FC074, 0x2699BD09, 0x2BB29596, 0x18209BB8, 0x08DC99A0,
+    0x31716728, 0x2B626D8D, 0x285DB56F, 0x0448A877, 0x067588E7, 0x2FB706DC,
+    0x16054385, 0x0A2101E4, 0x0858F963, 0x15267B7C, 0x11EB0B19, 0x2CA655E1,
+    0x2D2405E8, 0x25FA34EB, 0x02AE400B, 0x07B25129, 0x3170E726, 0x2BC1BDB9,
+    0x0A6AA1E8, 0x2BB755A3, 0x0FC842D3, 0x2B62858E, 0x03AC1845, 0x209E5C7A,
+    0x16E5B39E, 0x2ABF6D7F, 0x2EC50E5F, 0x2F206693, 0x0C706A34, 0x08E159A5,
+    0x09BEA1B9, 0x20A31C82, 0x20A28480, 0x2E775E3F, 0x02A55808, 0x316FB724,
+    0x03B6C84D, 0x030AC826, 0x2AB84D7A, 0x2F22C699, 0x1F56642D, 0x0A1F51E3,
+    0x11E40314, 0x230A2CB6, 0x2818555C, 0x0E2D427C, 0x1F595C2F, 0x0A7A11FD,
+    0x0A7C7200, 0x0E2E727F, 0x2818ED67, 0x08D0D194, 0x2D2AA5EB, 0x0675A0E8,
+    0x2BB5A5A0, 0x1DAE5410, 0x1F55CC2C, 0x08D7599C, 0x1F640C47, 0x1F62443D,
+    0x200D1463, 0x1D52FBFF, 0x0F4372B4, 0x149E1B6C, 0x0D398247, 0x1FBD9C5C,
+    0x1EBE9427, 0x38A877ED, 0x0D38EA46, 0x1DB3AC14, 0x067048E1, 0x0B37E212,
+    0x0A7979F6, 0x34F96F85, 0x1BBA5BDF, 0x2F023672, 0x0B3E6A17, 0x075EC926,
+    0x227684AC, 0x26EF3D13, 0x2F879EC1, 0x2736FD1E, 0x0D485A52, 0x2C9795D9,
+    0x08962170, 0x3503878D, 0x0D4B5255, 0x37B67FC3, 0x381437D6, 0x230BC4B8,
+    0x31A94F3A, 0x1CF55BE5, 0x063338CE, 0x212C2C91, 0x135B7B46, 0x0EED72AA,
+    0x2794B535, 0x0AFC9A05, 0x12B7CB3C, 0x2C9665D7, 0x0DAD3266, 0x2742DD23,
+    0x0B04D20E, 0x26980D03, 0x2B5E7587, 0x0AFE620A, 0x33BC276D, 0x14152360,
+    0x2DF25E06, 0x26F2CD18, 0x33BE8770, 0x04F55899, 0x2B591D82, 0x0A1C71DA,
+    0x126D132E, 0x34151F7B, 0x209F0C7C, 0x2F0EAE7E, 0x1016A2EE, 0x15239B7B,
+    0x04F42893, 0x2BC21DBC, 0x25FA4CEC, 0x33C63F72, 0x30C92704, 0x25A744E0,
+    0x3559EF91, 0x2EBCD65A, 0x2E6A6638, 0x2600D4ED, 0x316E9F20, 0x260464EF,
+    0x06B490EE, 0x1B3E73D2, 0x0A1421CD, 0x308A4EF6, 0x040C485E, 0x2BBF25B4,
+    0x3178B733, 0x30D17707, 0x075BD117, 0x0FD272E1, 0x03B3504C, 0x2ECA7E62,
+    0x07B3992A, 0x38E20FF2, 0x164B9B86, 0x221B2C9F, 0x12342B23, 0x0A1ED1E0,
+    0x1B4C1BD9, 0x02A4D805, 0x1D527BFE, 0x02BC9814, 0x1CFD13EB, 0x2E289621,
+    0x28186D5E, 0x123A1B28, 0x1D531400, 0x0E848A8D, 0x0E33E282, 0x08D0E995,
+    0x0F8E42CE, 0x16E2D399, 0x2E88164E, 0x0F3972AD, 0x0474B083, 0x0EE112A6,
+    0x1F642448, 0x38A337E6, 0x0896F176, 0x2FEB5EE3, 0x0D399A48, 0x27DAC549,
+    0x0383E836, 0x27842D2F, 0x30EC2F17, 0x22730CAB, 0x0F438AB5, 0x27872533,
+    0x20A34C83, 0x211D6C88, 0x0D988260, 0x0F425AB3, 0x34FDAF88, 0x2EED866B,
+    0x13ABA350, 0x2DF20E05, 0x2222FCA2, 0x222A1CAA, 0x0F4BDAC0, 0x35ACA79E,
+    0x25314CD2, 0x0898017D, 0x101182E9, 0x0435D871, 0x2E5E0626, 0x0897697A,
+    0x31A9673B, 0x355DC796, 0x35B627A2, 0x2EFFEE71, 0x2EFF566F, 0x2FBAC6DF,
+    0x2DFA5E0B, 0x0DAA5264, 0x092371B0, 0x253ACCD3, 0x084AE952, 0x2EE7166A,
+    0x26EF5515, 0x0E05AA70, 0x07F87941, 0x21C26495, 0x2B5EAD89, 0x043BC872,
+    0x2F07A678, 0x2813C558, 0x054AD8A7, 0x07569103, 0x381C07DA, 0x07FDD146,
+    0x029CA001, 0x02A1F803, 0x0B377A0F, 0x2BB3F59A, 0x31B54748, 0x15231B79,
+    0x126D2B2F, 0x0758590C, 0x2E652630, 0x1527437F, 0x2F14B683, 0x05ACB8B6,
+    0x12790B37, 0x1DA7640A, 0x38E18FF1, 0x2F17AE88, 0x2F700EA7, 0x2F6F76A0,
+    0x1B3DF3D1, 0x0A13A1CC, 0x2BBCDDAE, 0x1DA46C08, 0x0FCF92D8, 0x16E25396,
+    0x02AE700C, 0x38DE97F0, 0x2506A4CF, 0x0E840A8C, 0x06BC60F6, 0x0C208A28,
+    0x2DD2ADFF, 0x3026BEE7, 0x0A1BF1D7, 0x2F209696, 0x2E251E1E, 0x2F1B3E8E,
+    0x0A6AD1EA, 0x04125068, 0x03BB2051, 0x3EFA07FD, 0x30D64F0C, 0x2E7FDE4A,
+    0x1F5ABC30, 0x088E0167, 0x02C59819, 0x067A90E9, 0x3030D6ED, 0x2F8736BF,
+    0x08D10196, 0x30E0FF0F, 0x30362EF2, 0x3646EFB0, 0x1F63A444, 0x30E78713,
+    0x0E89628F, 0x0971B9B6, 0x08D7899D, 0x38A5AFE9, 0x1F5BEC33, 0x2219949E,
+    0x34F60F84, 0x175DBBB4, 0x38A8A7EE, 0x0D462A4D, 0x27D7E545, 0x0F43A2B7,
+    0x2C1F55D5, 0x1964B3C1, 0x1F5F7C3B, 0x27873D34, 0x38A3E7E7, 0x114FF308,
+    0x211FE489, 0x34FEF78A, 0x0D47F251, 0x35B9CFA7, 0x13606B4C, 0x2C97C5DA,
+    0x08994980, 0x31FBEF56, 0x0D782A5F, 0x2DF35608, 0x31A97F3C, 0x11AE4312,
+    0x31A8E734, 0x37B9A7C8, 0x19F173C9, 0x0896E975, 0x07AF2927, 0x089BA985,
+    0x1971C3C4, 0x1CFFC3F0, 0x1D4893F7, 0x245304C7, 0x2697A501, 0x31FBD755,
+    0x21866C93, 0x07F3393D, 0x2EA96E54, 0x269A9D0B, 0x26996D07, 0x1E310C1C,
+    0x244264C1, 0x2B6CE595, 0x039C583F, 0x126CAB2B, 0x0853E95D, 0x0DB6E268,
+    0x03B2504A, 0x075E6124, 0x274F852C, 0x126D4330, 0x15229B78, 0x0D306A45,
+    0x18835BBE, 0x0897817C, 0x2BC24DBE, 0x285A6D6A, 0x2EBFFE5D, 0x03A8D043,
+    0x2BB37599, 0x05AB08B5, 0x0DAFC267, 0x2F1B568F, 0x2F6F8EA2, 0x1A90DBCC,
+    0x1523337A, 0x209E0C78, 0x2DC0F5ED, 0x2BBD8DB0, 0x0407B85C, 0x0A6C19EB,
+    0x2F1DB691, 0x25AA6CE3, 0x2E1BB613, 0x127DE339, 0x2BBBC5A8, 0x28104D4F,
+    0x1CFDDBEC, 0x1D4CBBF9, 0x28134553, 0x0410A064, 0x1DAD6C0F, 0x1B4BB3D6,
+    0x0F83C2C7, 0x2F28669A, 0x1237EB26, 0x066FF8DE, 0x02BCC815, 0x302F26EC,
+    0x0A7C21FE, 0x176163B5, 0x0924B9B5, 0x2E282E20, 0x2F874EC0, 0x1F5E6435,
+    0x0E8BDA91, 0x03B7104E, 0x2813DD59, 0x1F628C41, 0x1FBD6C5A, 0x200CC462,
+    0x11F02B1B, 0x2BBE0DB2, 0x14A0C372, 0x0EE862A8, 0x27845D31, 0x201D8470,
+    0x1FBDE45D, 0x08D7099B, 0x11F4EB1F, 0x33F1AF79, 0x0F487ABE, 0x2F94F6D4,
+    0x0EED22A9, 0x26E4D510, 0x1EBF7429, 0x0F47E2BD, 0x11500B0A, 0x105A82F4,
+    0x10F7AAFB, 0x34FD4786, 0x0D46424E, 0x3500D78B, 0x355DF797, 0x175ADBB3,
+    0x03E0A053, 0x258814DD, 0x08970177, 0x37B6C7C6, 0x135F534A, 0x07ECC930,
+    0x05E798BE, 0x31A9973D, 0x07F0593C, 0x135D8B47, 0x31A8FF36, 0x04E7F88A,
+    0x27D3D53F, 0x3D793FFA, 0x26F3351A, 0x04E8908B, 0x2695F4FF, 0x08119949,
+    0x054480A0, 0x2698ED05, 0x084EA958, 0x0546E0A3, 0x02BCE016, 0x342A2F7E,
+    0x31743F2D, 0x33B97769, 0x2F87FEC3, 0x2F099E7A, 0x2F88B6C4, 0x15748B80,
+    0x054648A2, 0x0853695B, 0x20A4AC86, 0x2BBD0DAF, 0x05AA88B4, 0x0A10D9C4,
+    0x0451F07A, 0x2E655631, 0x1E3D0422, 0x25A5C4DE, 0x1E3FFC24, 0x22181C9D,
+    0x06B018EB, 0x30E60F12, 0x25AC4CE5, 0x0F8DF2CD, 0x321E7758, 0x22FB1CAD,
+    0x25B23CE6, 0x092141AE, 0x2BC1CDBA, 0x28106550, 0x2E1BCE14, 0x1D4813F5,
+    0x0FD0F2E0, 0x0815294C, 0x0A6FC1F0, 0x0813F94B, 0x02AEA00D, 0x2BC09DB8,
+    0x19F0D3C7, 0x066988D8, 0x2F7B86B2, 0x1DA40407, 0x2DCFE5FD, 0x14903B62,
+    0x2818B562, 0x066C80DB, 0x2F8046BB, 0x16EDCBA6, 0x1B4EC3DB, 0x0A79D9FA,
+    0x12380327, 0x1FB0EC51, 0x2F7DE6B8, 0x30C8D702, 0x0E899290, 0x067010E0,
+    0x16EEFBA8, 0x2DC82DF4, 0x2019EC6F, 0x11F0431C, 0x2227F4A8, 0x0FCA8AD4,
+    0x08D09991, 0x0E927A9D, 0x251F2CD0, 0x1D02A3F3, 0x3094AEFD, 0x062BE0C8,
+    0x0E413A89, 0x2EE6AE68, 0x195E5BC0, 0x257BB4DA, 0x2F9346CF, 0x04291070,
+    0x376A7FBC, 0x08E139A4, 0x2FF0FEE6, 0x31BA4F4E, 0x114F8B06, 0x34FD5F87,
+    0x2226D4A6, 0x0F4762BB, 0x0DC53A6B, 0x1357B342, 0x10F7C2FD, 0x1EC8742A,
+    0x1F5B0C32, 0x31FC1F57, 0x02BB1812, 0x31F88F54, 0x31A91738, 0x37646FB4,
+    0x07ECE133, 0x355D7795, 0x11B16B13, 0x0AF54202, 0x07EFD938, 0x212AC48C,
+    0x31AF9F42, 0x0541089B, 0x26EDD512, 0x08483950, 0x04EF308E, 0x2CA59DE0,
+    0x0C4F0A2F, 0x33B7C767, 0x3255175E, 0x084EC15A, 0x269444FC, 0x135F6B4B,
+    0x2F075677, 0x038BE83C, 0x16C9138A, 0x126CDB2C, 0x15223377, 0x2697D502,
+    0x37B897C7, 0x043FA073, 0x2F7336AC, 0x28139555, 0x05A840B3, 0x2F3C169D,
+    0x2BB30D98, 0x0307B025, 0x2EC02E5E, 0x25A674DF, 0x2B62658C, 0x2E64D62E,
+    0x316F9722, 0x2BB7CDA4, 0x1AE4ABCE, 0x331F5F60, 0x2F17F68A, 0x0A1E99DE,
+    0x30C8EF03, 0x2E1BE616, 0x2E6A2E34, 0x30D39F09, 0x2F8D6EC8, 0x2ABEB57D,
+    0x0C2AEA2D, 0x0813794A, 0x0F7D6AC4, 0x16E5939D, 0x28107D52, 0x2F22A698,
+    0x0A1F31E2, 0x2667D4F4, 0x2F8A76C5, 0x19F183CA, 0x2308DCB2, 0x02AE200A,
+    0x0A78C1F4, 0x0410D065, 0x0F88B2CA, 0x1D537401, 0x03B2804B, 0x04747882,
+    0x2E24CE1D, 0x11E47B17, 0x06B030EC, 0x2D29EDEA, 0x35AB5F9B, 0x1DB12C12,
+    0x02BCF817, 0x0A79F1FC, 0x02C5E01A, 0x2DEC9E03, 0x27D9F548, 0x303416EF,
+    0x11EFC31A, 0x0F3C32AF, 0x1F64844A, 0x27D1A53D, 0x0425986B, 0x1FBF4461,
+    0x27CF453A, 0x33E4E774, 0x2EDC1667, 0x2F95BED6, 0x2F948ED0, 0x062EF0C9,
+    0x302A96E9, 0x1FB8BC54, 0x0A6EA9EE, 0x0F4222B2, 0x04F00090, 0x0AFE4209,
+    0x2E1A1E10, 0x1498C365, 0x1005E2E4, 0x2124EC8A, 0x07ECF935, 0x3558CF90,
+    0x2BB4ED9F, 0x268B74F5, 0x26225CF1, 0x063610D3, 0x16BB8388, 0x376487B6,
+    0x0D470A4F, 0x0893096B, 0x2DF85E09, 0x2DCF65FC, 0x3D796FFB, 0x2F06AE73,
+    0x089DB98C, 0x07EFF13A, 0x07F3813F, 0x075D1921, 0x2E69CE32, 0x100972E6,
+    0x089AC184, 0x33B57F63, 0x02FF0024, 0x0D53DA5D, 0x05F1E0C4, 0x074E08FE,
+    0x2FB406D9, 0x074F3900, 0x187A23BD, 0x274BA529, 0x2F95DED7, 0x0A1E69DC,
+    0x269B050C, 0x274F352B, 0x05A728B2, 0x2FBA8EDE, 0x12737B34, 0x07578906,
+    0x20A44485, 0x0FC37AD1, 0x23013CAE, 0x2F72CEA9, 0x02A55007, 0x2C1045CB,
+    0x09BF31BB, 0x2E6A4636, 0x2C0E7DC8, 0x2B64458F, 0x2F6FD6A5, 0x302EF6EB,
+    0x0FCD92D7, 0x2ABBD57C, 0x20A14C7E, 0x260444EE, 0x20A31481, 0x2F1B068D,
+    0x18347BBB, 0x16E3E39A,
+};
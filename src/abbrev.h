@@ -0,0 +1,20 @@
+#ifndef ABBREV_H
+#define ABBREV_H
+
+#include <stdint.h>
+#include "arduino-support.h"
+
+// Minimal perfect hash from a word's first four letters to the word. The
+// key packs up to four letters in base 27 (a = 1 ... z = 26, 0 padding
+// three-letter words). Multiplying the key by BIP39_ABBREV_MULTIPLIER, the
+// top 10 bits pick a bucket and the next 11 bits, XORed with the bucket's
+// displacement, pick a slot. Each slot holds the key above bit 11 and the
+// word number below it, so one probe both finds and verifies the word.
+#define BIP39_ABBREV_MULTIPLIER 0x85EBCA6BUL
+#define BIP39_ABBREV_BUCKETS 1024
+#define BIP39_ABBREV_SLOTS 2048
+
+extern const uint16_t bip39_abbrev_displacements[BIP39_ABBREV_BUCKETS] PROGMEM;
+extern const uint32_t bip39_abbrev_slots[BIP39_ABBREV_SLOTS] PROGMEM;
+
+#endif /* ABBREV_H */
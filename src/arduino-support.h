@@ -1,17 +1,21 @@
 #ifndef ARDUINO_SUPPORT_H
 #define ARDUINO_SUPPORT_H
 
-#ifdef ARDUINO
+#if defined(ARDUINO) || defined(__AVR__)
 #include <avr/pgmspace.h>
+#ifdef ARDUINO
 #include <Arduino.h>
-#define MEMCPY_P(x, y, z) memcpy_P(x, y, z)
+#endif
 #define STRCPY_P(x, y) strcpy_P(x, y)
+#define PGM_READ_BYTE(x) pgm_read_byte(x)
 #define PGM_READ_WORD(x) pgm_read_word(x)
+#define PGM_READ_DWORD(x) pgm_read_dword(x)
 #else
 #define PROGMEM
-#define MEMCPY_P(x, y, z) memcpy(x, y, z)
 #define STRCPY_P(x, y) strcpy(x, y)
-#define PGM_READ_WORD(x) (*x)
+#define PGM_READ_BYTE(x) (*(x))
+#define PGM_READ_WORD(x) (*(x))
+#define PGM_READ_DWORD(x) (*(x))
 #endif
 
 #endif /* ARDUINO_SUPPORT_H */
@@ -0,0 +1,123 @@
+#include "arena.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include "bc-crypto-base.h"
+#else
+#include <bc-crypto-base/bc-crypto-base.h>
+#endif
+
+#if defined(ARDUINO) || defined(__AVR__)
+
+void* bip39_secure_alloc(size_t len) {
+    return calloc(len, 1);
+}
+
+void bip39_secure_free(void* p, size_t len) {
+    if (p == NULL) {
+        return;
+    }
+    memzero(p, len);
+    free(p);
+}
+
+#else
+
+#include <pthread.h>
+#include <sys/mman.h>
+
+// The small slots come first, then the large ones.
+#define ARENA_SMALL_SLOTS 96
+#define ARENA_LARGE_SLOTS 8
+#define ARENA_SMALL_LEN (ARENA_SMALL_SLOTS * ARENA_SMALL_SLOT_LEN)
+#define ARENA_LEN (ARENA_SMALL_LEN + ARENA_LARGE_SLOTS * ARENA_SLOT_LEN)
+
+typedef struct free_slot_t {
+    struct free_slot_t* next;
+} free_slot;
+
+static pthread_once_t arena_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t arena_mutex = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t* arena;
+static free_slot* arena_free_small;
+static free_slot* arena_free_large;
+
+static void push_slot(free_slot** list, void* p) {
+    free_slot* slot = p;
+    slot->next = *list;
+    *list = slot;
+}
+
+static free_slot* pop_slot(free_slot** list) {
+    free_slot* slot = *list;
+    if (slot != NULL) {
+        *list = slot->next;
+    }
+    return slot;
+}
+
+static void arena_init() {
+    void* pages = mmap(NULL, ARENA_LEN, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pages == MAP_FAILED) {
+        return;
+    }
+    // Locking is best effort: if RLIMIT_MEMLOCK forbids it the pool still
+    // works, it just may be swapped.
+    mlock(pages, ARENA_LEN);
+#ifdef MADV_DONTDUMP
+    madvise(pages, ARENA_LEN, MADV_DONTDUMP);
+#endif
+    arena = pages;
+    for (size_t i = ARENA_SMALL_SLOTS; i > 0; i--) {
+        push_slot(&arena_free_small, arena + (i - 1) * ARENA_SMALL_SLOT_LEN);
+    }
+    for (size_t i = ARENA_LARGE_SLOTS; i > 0; i--) {
+        push_slot(&arena_free_large, arena + ARENA_SMALL_LEN + (i - 1) * ARENA_SLOT_LEN);
+    }
+}
+
+static int in_arena(const void* p) {
+    return arena != NULL && (const uint8_t*)p >= arena && (const uint8_t*)p < arena + ARENA_LEN;
+}
+
+void* bip39_secure_alloc(size_t len) {
+    if (len <= ARENA_SLOT_LEN) {
+        pthread_once(&arena_once, arena_init);
+        pthread_mutex_lock(&arena_mutex);
+        free_slot* slot = NULL;
+        if (len <= ARENA_SMALL_SLOT_LEN) {
+            slot = pop_slot(&arena_free_small);
+        }
+        if (slot == NULL) {
+            slot = pop_slot(&arena_free_large);
+        }
+        pthread_mutex_unlock(&arena_mutex);
+        if (slot != NULL) {
+            slot->next = NULL;
+            return slot;
+        }
+    }
+    return calloc(len, 1);
+}
+
+void bip39_secure_free(void* p, size_t len) {
+    if (p == NULL) {
+        return;
+    }
+    if (!in_arena(p)) {
+        memzero(p, len);
+        free(p);
+        return;
+    }
+    // Wipe the whole slot, so callers need not remember the original size.
+    bool small = (uint8_t*)p < arena + ARENA_SMALL_LEN;
+    memzero(p, small ? ARENA_SMALL_SLOT_LEN : ARENA_SLOT_LEN);
+    pthread_mutex_lock(&arena_mutex);
+    push_slot(small ? &arena_free_small : &arena_free_large, p);
+    pthread_mutex_unlock(&arena_mutex);
+}
+
+#endif /* ARDUINO */
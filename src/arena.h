@@ -0,0 +1,21 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdlib.h>
+
+// Secret-holding allocations. Blocks of up to ARENA_SLOT_LEN bytes come from
+// a small pool of mlock'd pages, so they stay out of swap and core dumps
+// without an mlock call per operation. The pool has two size classes:
+// small slots fit contexts, hash states, keys and salts for ordinary
+// passphrases, and a few large slots take joined phrases. A block uses the
+// smallest free slot that fits. Larger blocks, or any block once the pool
+// is exhausted, fall back to calloc without locking, so they may reach
+// swap. Blocks are returned zeroed and are wiped when released. Returns
+// NULL only if that calloc fails; every caller must check.
+#define ARENA_SMALL_SLOT_LEN 128
+#define ARENA_SLOT_LEN 512
+
+void* bip39_secure_alloc(size_t len);
+void bip39_secure_free(void* p, size_t len);
+
+#endif /* ARENA_H */
@@ -0,0 +1,327 @@
+#ifndef ARDUINO
+
+#include "bip39.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#endif
+
+#include <bc-crypto-base/bc-crypto-base.h>
+
+typedef struct seed_job_t {
+    struct seed_job_t* next;
+
+    uint64_t id;
+    char* mnemonics;
+    char* passphrase;
+    bip39_seed_callback callback;
+    void* user_data;
+
+    bool cancelled;
+    bool failed;
+    uint8_t seed[BIP39_MNEMONIC_SEED_LEN];
+} seed_job;
+
+typedef struct job_list_t {
+    seed_job* head;
+    seed_job* tail;
+} job_list;
+
+typedef struct seed_queue_t {
+    pthread_mutex_t mutex;
+    pthread_cond_t available;
+
+    job_list pending;
+    job_list running;
+    job_list completed;
+
+    size_t outstanding;
+    size_t max_jobs;
+    uint64_t next_id;
+    bool stopping;
+
+    pthread_t* threads;
+    size_t threads_len;
+
+    // Completion signal: an eventfd on Linux (both entries are the same
+    // descriptor), otherwise a self-pipe.
+    int fds[2];
+} seed_queue;
+
+static void push_job(job_list* list, seed_job* job) {
+    job->next = NULL;
+    if (list->tail == NULL) {
+        list->head = job;
+    } else {
+        list->tail->next = job;
+    }
+    list->tail = job;
+}
+
+static seed_job* pop_job(job_list* list) {
+    seed_job* job = list->head;
+    if (job != NULL) {
+        list->head = job->next;
+        if (list->head == NULL) {
+            list->tail = NULL;
+        }
+    }
+    return job;
+}
+
+static seed_job* remove_job(job_list* list, uint64_t id) {
+    seed_job* prev = NULL;
+    for (seed_job* job = list->head; job != NULL; prev = job, job = job->next) {
+        if (job->id == id) {
+            if (prev == NULL) {
+                list->head = job->next;
+            } else {
+                prev->next = job->next;
+            }
+            if (list->tail == job) {
+                list->tail = prev;
+            }
+            return job;
+        }
+    }
+    return NULL;
+}
+
+static void free_string(char* s) {
+    if (s != NULL) {
+        memzero(s, strlen(s));
+        free(s);
+    }
+}
+
+static void free_job(seed_job* job) {
+    free_string(job->mnemonics);
+    free_string(job->passphrase);
+    memzero(job, sizeof(seed_job));
+    free(job);
+}
+
+static void signal_completion(seed_queue* q) {
+#if defined(__linux__)
+    uint64_t one = 1;
+    while (write(q->fds[1], &one, sizeof(one)) < 0 && errno == EINTR) { }
+#else
+    char one = 1;
+    while (write(q->fds[1], &one, sizeof(one)) < 0 && errno == EINTR) { }
+#endif
+}
+
+static void drain_signal(seed_queue* q) {
+    uint8_t buf[64];
+    while (read(q->fds[0], buf, sizeof(buf)) > 0) { }
+}
+
+static void* worker(void* arg) {
+    seed_queue* q = arg;
+
+    pthread_mutex_lock(&q->mutex);
+    for (;;) {
+        while (!q->stopping && q->pending.head == NULL) {
+            pthread_cond_wait(&q->available, &q->mutex);
+        }
+        if (q->stopping) {
+            break;
+        }
+        seed_job* job = pop_job(&q->pending);
+        push_job(&q->running, job);
+        pthread_mutex_unlock(&q->mutex);
+
+        bool derived = bip39_seed_from_mnemonics(job->mnemonics, job->passphrase, job->seed);
+
+        pthread_mutex_lock(&q->mutex);
+        job->failed = !derived;
+        remove_job(&q->running, job->id);
+        push_job(&q->completed, job);
+        signal_completion(q);
+    }
+    pthread_mutex_unlock(&q->mutex);
+
+    return NULL;
+}
+
+void* bip39_new_seed_queue(size_t threads, size_t max_jobs) {
+    if (threads == 0 || max_jobs == 0) {
+        return NULL;
+    }
+    seed_queue* q = calloc(sizeof(seed_queue), 1);
+    if (q == NULL) {
+        return NULL;
+    }
+    q->max_jobs = max_jobs;
+    q->next_id = 1;
+
+#if defined(__linux__)
+    q->fds[0] = q->fds[1] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (q->fds[0] < 0) {
+        free(q);
+        return NULL;
+    }
+#else
+    if (pipe(q->fds) != 0) {
+        free(q);
+        return NULL;
+    }
+    for (int i = 0; i < 2; i++) {
+        fcntl(q->fds[i], F_SETFL, fcntl(q->fds[i], F_GETFL) | O_NONBLOCK);
+        fcntl(q->fds[i], F_SETFD, FD_CLOEXEC);
+    }
+#endif
+
+    pthread_mutex_init(&q->mutex, NULL);
+    pthread_cond_init(&q->available, NULL);
+
+    q->threads = calloc(sizeof(pthread_t), threads);
+    for (size_t i = 0; q->threads != NULL && i < threads; i++) {
+        if (pthread_create(&q->threads[i], NULL, worker, q) != 0) {
+            break;
+        }
+        q->threads_len++;
+    }
+    if (q->threads_len == 0) {
+        bip39_dispose_seed_queue(q);
+        return NULL;
+    }
+
+    return q;
+}
+
+void bip39_dispose_seed_queue(void* queue) {
+    seed_queue* q = queue;
+
+    pthread_mutex_lock(&q->mutex);
+    q->stopping = true;
+    pthread_cond_broadcast(&q->available);
+    pthread_mutex_unlock(&q->mutex);
+
+    for (size_t i = 0; i < q->threads_len; i++) {
+        pthread_join(q->threads[i], NULL);
+    }
+    free(q->threads);
+
+    seed_job* job;
+    while ((job = pop_job(&q->pending)) != NULL) {
+        free_job(job);
+    }
+    while ((job = pop_job(&q->completed)) != NULL) {
+        free_job(job);
+    }
+
+    close(q->fds[0]);
+    if (q->fds[1] != q->fds[0]) {
+        close(q->fds[1]);
+    }
+    pthread_cond_destroy(&q->available);
+    pthread_mutex_destroy(&q->mutex);
+    free(q);
+}
+
+uint64_t bip39_submit_seed(void* queue, const char* mnemonics, const char* passphrase, bip39_seed_callback callback, void* user_data) {
+    seed_queue* q = queue;
+
+    // Build the job first, so a failed allocation leaves the queue as it was.
+    seed_job* job = calloc(sizeof(seed_job), 1);
+    if (job == NULL) {
+        return 0;
+    }
+    job->mnemonics = strdup(mnemonics);
+    job->passphrase = strdup(passphrase == NULL ? "" : passphrase);
+    job->callback = callback;
+    job->user_data = user_data;
+    if (job->mnemonics == NULL || job->passphrase == NULL) {
+        free_job(job);
+        return 0;
+    }
+
+    pthread_mutex_lock(&q->mutex);
+    if (q->outstanding >= q->max_jobs) {
+        pthread_mutex_unlock(&q->mutex);
+        free_job(job);
+        return 0;
+    }
+    q->outstanding++;
+    uint64_t id = q->next_id++;
+    job->id = id;
+    push_job(&q->pending, job);
+    pthread_cond_signal(&q->available);
+    pthread_mutex_unlock(&q->mutex);
+
+    return id;
+}
+
+bool bip39_cancel_seed(void* queue, uint64_t job_id) {
+    seed_queue* q = queue;
+    bool result = false;
+
+    pthread_mutex_lock(&q->mutex);
+    seed_job* job = remove_job(&q->pending, job_id);
+    if (job != NULL) {
+        job->cancelled = true;
+        push_job(&q->completed, job);
+        signal_completion(q);
+        result = true;
+    } else {
+        for (job = q->running.head; job != NULL; job = job->next) {
+            if (job->id == job_id) {
+                job->cancelled = true;
+                result = true;
+                break;
+            }
+        }
+    }
+    pthread_mutex_unlock(&q->mutex);
+
+    return result;
+}
+
+int bip39_seed_queue_fd(const void* queue) {
+    const seed_queue* q = queue;
+    return q->fds[0];
+}
+
+size_t bip39_poll_seeds(void* queue, size_t max_completions) {
+    seed_queue* q = queue;
+    size_t delivered = 0;
+
+    pthread_mutex_lock(&q->mutex);
+    drain_signal(q);
+    while (delivered < max_completions) {
+        seed_job* job = pop_job(&q->completed);
+        if (job == NULL) {
+            break;
+        }
+        q->outstanding--;
+        pthread_mutex_unlock(&q->mutex);
+
+        if (job->cancelled) {
+            job->callback(job->id, BIP39_SEED_CANCELLED, NULL, job->user_data);
+        } else if (job->failed) {
+            job->callback(job->id, BIP39_SEED_FAILED, NULL, job->user_data);
+        } else {
+            job->callback(job->id, BIP39_SEED_OK, job->seed, job->user_data);
+        }
+        free_job(job);
+        delivered++;
+
+        pthread_mutex_lock(&q->mutex);
+    }
+    // Completions left behind keep the descriptor readable.
+    if (q->completed.head != NULL) {
+        signal_completion(q);
+    }
+    pthread_mutex_unlock(&q->mutex);
+
+    return delivered;
+}
+
+#endif /* ARDUINO */
@@ -0,0 +1,332 @@
+#include "bip39.h"
+#include "kernels.h"
+#include "lookup.h"
+
+#include <string.h>
+
+#ifdef ARDUINO
+#include "bc-crypto-base.h"
+#else
+#include <bc-crypto-base/bc-crypto-base.h>
+#include <pthread.h>
+#endif
+
+// Phrase to BIP32 master key in one pass: the phrase is tokenized and
+// checked in place, re-joined with single spaces (the form BIP39 hashes),
+// stretched with PBKDF2 and fed to HMAC-SHA512 keyed with "Bitcoin seed".
+// Everything lives on the stack and is wiped before returning.
+
+#define MAX_PHRASE_LEN (24 * 9)
+#define MAX_INLINE_PASSPHRASE_LEN 256
+#define SALT_PREFIX "mnemonic"
+#define SALT_PREFIX_LEN 8
+
+// The order of the secp256k1 group, big-endian.
+static const uint8_t curve_order[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0xBA, 0xAE, 0xDC, 0xE6, 0xAF, 0x48, 0xA0, 0x3B,
+    0xBF, 0xD2, 0x5E, 0x8C, 0xD0, 0x36, 0x41, 0x41
+};
+
+// Checked without branching on the key.
+static bool is_below_order(const uint8_t* key) {
+    int borrow = 0;
+    for (int i = 31; i >= 0; i--) {
+        borrow = ((int)key[i] - curve_order[i] - borrow) >> 8 & 1;
+    }
+    return borrow == 1;
+}
+
+// A private key must be in [1, n - 1].
+static bool is_valid_private_key(const uint8_t* key) {
+    uint8_t nonzero = 0;
+    for (int i = 0; i < 32; i++) {
+        nonzero |= key[i];
+    }
+    return (nonzero != 0) & is_below_order(key);
+}
+
+// r = (a + b) mod n, for a and b below n.
+static void add_mod_order(const uint8_t* a, const uint8_t* b, uint8_t* r) {
+    uint8_t sum[32];
+    uint8_t diff[32];
+    int carry = 0;
+    int borrow = 0;
+    for (int i = 31; i >= 0; i--) {
+        int t = a[i] + b[i] + carry;
+        sum[i] = t;
+        carry = t >> 8;
+    }
+    for (int i = 31; i >= 0; i--) {
+        int t = (int)sum[i] - curve_order[i] - borrow;
+        diff[i] = t;
+        borrow = t >> 8 & 1;
+    }
+    // Keep the difference if the sum overflowed or is at least n.
+    uint8_t use_diff = -(uint8_t)(carry | (borrow ^ 1));
+    for (int i = 0; i < 32; i++) {
+        r[i] = (diff[i] & use_diff) | (sum[i] & ~use_diff);
+    }
+    memzero(sum, sizeof(sum));
+    memzero(diff, sizeof(diff));
+}
+
+// Derives the hardened child `index` of an extended private key (32-byte
+// key then 32-byte chain code) into `child`, which may alias `parent`.
+// Returns false in the 2^-127 case where the child is invalid.
+static bool derive_hardened(const uint8_t* parent, uint32_t index, uint8_t* child) {
+    uint8_t data[1 + 32 + 4];
+    uint8_t i[SHA512_DIGEST_LENGTH];
+    index |= 0x80000000;
+    data[0] = 0;
+    memcpy(data + 1, parent, 32);
+    data[33] = index >> 24;
+    data[34] = index >> 16;
+    data[35] = index >> 8;
+    data[36] = index;
+    hmac_sha512(parent + 32, 32, data, sizeof(data), i);
+
+    bool result = is_below_order(i);
+    if (result) {
+        add_mod_order(i, parent, child);
+        memcpy(child + 32, i + 32, 32);
+        result = is_valid_private_key(child);
+    }
+    memzero(data, sizeof(data));
+    memzero(i, sizeof(i));
+    return result;
+}
+
+// PBKDF2-HMAC-SHA512 with one 64-byte block and the salt fed in pieces, for
+// passphrases too long for the stack salt. The keyed inner and outer states
+// are set up once and copied for each round.
+static void streaming_pbkdf2(const char* phrase, size_t phrase_len, const char* passphrase, size_t passphrase_len, uint8_t* seed) {
+    static const uint8_t block_number[4] = { 0, 0, 0, 1 };
+    HMAC_SHA512_CTX keyed;
+    HMAC_SHA512_CTX hctx;
+    uint8_t u[SHA512_DIGEST_LENGTH];
+
+    hmac_sha512_Init(&keyed, (const uint8_t*)phrase, phrase_len);
+    hctx = keyed;
+    hmac_sha512_Update(&hctx, (const uint8_t*)SALT_PREFIX, SALT_PREFIX_LEN);
+    hmac_sha512_Update(&hctx, (const uint8_t*)passphrase, passphrase_len);
+    hmac_sha512_Update(&hctx, block_number, sizeof(block_number));
+    hmac_sha512_Final(&hctx, u);
+    memcpy(seed, u, BIP39_MNEMONIC_SEED_LEN);
+
+    for (uint32_t round = 1; round < BIP39_PBKDF2_ROUNDS; round++) {
+        hctx = keyed;
+        hmac_sha512_Update(&hctx, u, sizeof(u));
+        hmac_sha512_Final(&hctx, u);
+        for (int i = 0; i < BIP39_MNEMONIC_SEED_LEN; i++) {
+            seed[i] ^= u[i];
+        }
+    }
+
+    memzero(&keyed, sizeof(keyed));
+    memzero(&hctx, sizeof(hctx));
+    memzero(u, sizeof(u));
+}
+
+static void derive_seed(const char* phrase, size_t phrase_len, const char* passphrase, uint8_t* seed) {
+    size_t passphrase_len = strlen(passphrase);
+    if (passphrase_len > MAX_INLINE_PASSPHRASE_LEN) {
+        streaming_pbkdf2(phrase, phrase_len, passphrase, passphrase_len, seed);
+        return;
+    }
+    uint8_t salt[SALT_PREFIX_LEN + MAX_INLINE_PASSPHRASE_LEN];
+    memcpy(salt, SALT_PREFIX, SALT_PREFIX_LEN);
+    memcpy(salt + SALT_PREFIX_LEN, passphrase, passphrase_len);
+    pbkdf2_hmac_sha512((const uint8_t*)phrase, phrase_len, salt, SALT_PREFIX_LEN + passphrase_len, BIP39_PBKDF2_ROUNDS, seed, BIP39_MNEMONIC_SEED_LEN);
+    memzero(salt, sizeof(salt));
+}
+
+bool bip39_master_key_from_mnemonics(const char* mnemonics, size_t mnemonics_len, const char* passphrase, uint8_t* master_key) {
+    bool result = false;
+    uint16_t words[24];
+    uint8_t secret[32];
+    char phrase[MAX_PHRASE_LEN];
+    uint8_t seed[BIP39_MNEMONIC_SEED_LEN];
+
+    size_t words_len = bip39_words_from_mnemonics_len(mnemonics, mnemonics_len, words, 24);
+    const bip39_kernel* kernel = bip39_kernel_for_words_len(words_len);
+    if (kernel == NULL || !kernel->decode(words, secret)) {
+        goto done;
+    }
+
+    size_t phrase_len = 0;
+    for (size_t i = 0; i < words_len; i++) {
+        if (i != 0) {
+            phrase[phrase_len++] = ' ';
+        }
+        bip39_load_mnemonic(words[i], phrase + phrase_len);
+        phrase_len += strlen(phrase + phrase_len);
+    }
+
+    derive_seed(phrase, phrase_len, passphrase == NULL ? "" : passphrase, seed);
+    hmac_sha512((const uint8_t*)"Bitcoin seed", 12, seed, sizeof(seed), master_key);
+    result = is_valid_private_key(master_key);
+
+done:
+    if (!result) {
+        memzero(master_key, BIP39_MASTER_KEY_LEN);
+    }
+    memzero(words, sizeof(words));
+    memzero(secret, sizeof(secret));
+    memzero(phrase, sizeof(phrase));
+    memzero(seed, sizeof(seed));
+    return result;
+}
+
+// BIP85: the child phrase for `index` comes from the key at
+// m/83696968'/39'/0'/{words}'/{index}' (0' being English), hashed with
+// HMAC-SHA512 keyed with "bip-entropy-from-k" and truncated to the secret
+// length. The path up to {words}' is shared by every index.
+
+#define BIP85_APPLICATION 83696968
+#define BIP85_BIP39 39
+#define BIP85_ENGLISH 0
+
+static const bip39_kernel* bip85_kernel(size_t words_len) {
+    if (words_len != 12 && words_len != 18 && words_len != 24) {
+        return NULL;
+    }
+    return bip39_kernel_for_words_len(words_len);
+}
+
+static bool bip85_parent(const uint8_t* master_key, size_t words_len, uint8_t* parent) {
+    return derive_hardened(master_key, BIP85_APPLICATION, parent) &&
+        derive_hardened(parent, BIP85_BIP39, parent) &&
+        derive_hardened(parent, BIP85_ENGLISH, parent) &&
+        derive_hardened(parent, words_len, parent);
+}
+
+static bool bip85_child_words(const uint8_t* parent, const bip39_kernel* kernel, uint32_t index, uint16_t* words) {
+    uint8_t child[BIP39_MASTER_KEY_LEN];
+    uint8_t entropy[SHA512_DIGEST_LENGTH];
+    bool result = derive_hardened(parent, index, child);
+    if (result) {
+        hmac_sha512((const uint8_t*)"bip-entropy-from-k", 18, child, 32, entropy);
+        kernel->encode(entropy, words);
+    }
+    memzero(child, sizeof(child));
+    memzero(entropy, sizeof(entropy));
+    return result;
+}
+
+size_t bip39_bip85_words_batch(const uint8_t* master_key, size_t words_len, uint32_t first_index, size_t count, uint16_t* words) {
+    const bip39_kernel* kernel = bip85_kernel(words_len);
+    if (kernel == NULL) {
+        return 0;
+    }
+    uint8_t parent[BIP39_MASTER_KEY_LEN];
+    size_t derived = 0;
+    if (bip85_parent(master_key, words_len, parent)) {
+        while (derived < count && first_index + derived < 0x80000000 &&
+            bip85_child_words(parent, kernel, first_index + derived, words + derived * words_len)) {
+            derived++;
+        }
+    }
+    memzero(parent, sizeof(parent));
+    return derived;
+}
+
+size_t bip39_bip85_words(const uint8_t* master_key, size_t words_len, uint32_t index, uint16_t* words) {
+    return bip39_bip85_words_batch(master_key, words_len, index, 1, words) == 1 ? words_len : 0;
+}
+
+size_t bip39_bip85_mnemonics(const uint8_t* master_key, size_t words_len, uint32_t index, char* mnemonics, size_t max_mnemonics_len) {
+    uint16_t words[24];
+    char phrase[MAX_PHRASE_LEN];
+    size_t phrase_len = 0;
+    if (bip39_bip85_words(master_key, words_len, index, words) != 0) {
+        for (size_t i = 0; i < words_len; i++) {
+            if (i != 0) {
+                phrase[phrase_len++] = ' ';
+            }
+            bip39_load_mnemonic(words[i], phrase + phrase_len);
+            phrase_len += strlen(phrase + phrase_len);
+        }
+        if (phrase_len < max_mnemonics_len) {
+            memcpy(mnemonics, phrase, phrase_len + 1);
+        } else {
+            phrase_len = 0;
+        }
+    }
+    memzero(words, sizeof(words));
+    memzero(phrase, sizeof(phrase));
+    return phrase_len;
+}
+
+#ifndef ARDUINO
+
+#define MAX_BATCH_THREADS 64
+
+typedef struct batch_t {
+    const char* const* mnemonics;
+    const char* const* passphrases;
+    uint8_t* master_keys;
+    bool* valid;
+    size_t begin;
+    size_t end;
+    size_t valid_count;
+} batch;
+
+static void* run_batch(void* arg) {
+    batch* b = arg;
+    for (size_t i = b->begin; i < b->end; i++) {
+        const char* passphrase = b->passphrases == NULL ? NULL : b->passphrases[i];
+        const char* mnemonics = b->mnemonics[i];
+        bool ok = bip39_master_key_from_mnemonics(mnemonics, strlen(mnemonics), passphrase, b->master_keys + i * BIP39_MASTER_KEY_LEN);
+        if (b->valid != NULL) {
+            b->valid[i] = ok;
+        }
+        if (ok) {
+            b->valid_count++;
+        }
+    }
+    return NULL;
+}
+
+size_t bip39_master_keys_from_mnemonics(const char* const* mnemonics, const char* const* passphrases, size_t count, size_t threads, uint8_t* master_keys, bool* valid) {
+    if (threads == 0) {
+        threads = 1;
+    }
+    if (threads > MAX_BATCH_THREADS) {
+        threads = MAX_BATCH_THREADS;
+    }
+    if (threads > count) {
+        threads = count;
+    }
+
+    batch batches[MAX_BATCH_THREADS];
+    pthread_t ids[MAX_BATCH_THREADS];
+    bool started[MAX_BATCH_THREADS];
+    for (size_t t = 0; t < threads; t++) {
+        batch* b = &batches[t];
+        b->mnemonics = mnemonics;
+        b->passphrases = passphrases;
+        b->master_keys = master_keys;
+        b->valid = valid;
+        b->begin = count * t / threads;
+        b->end = count * (t + 1) / threads;
+        b->valid_count = 0;
+        // The calling thread takes the first share itself, as well as any
+        // share whose thread could not be started.
+        started[t] = t > 0 && pthread_create(&ids[t], NULL, run_batch, b) == 0;
+    }
+
+    size_t valid_count = 0;
+    for (size_t t = 0; t < threads; t++) {
+        if (started[t]) {
+            pthread_join(ids[t], NULL);
+        } else {
+            run_batch(&batches[t]);
+        }
+        valid_count += batches[t].valid_count;
+    }
+    return valid_count;
+}
+
+#endif
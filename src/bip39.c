@@ -4,12 +4,23 @@
 
 #include "prefix1.h"
 #include "prefix2.h"
+#include "keypad.h"
+#include "abbrev.h"
 
 #include "suffix_array.h"
+#include "entropy.h"
+#include "arena.h"
+#include "kernels.h"
+#include "lookup.h"
 
 #include <stdlib.h>
 #include <string.h>
 
+#if !defined(ARDUINO) && !defined(__AVR__)
+#include <errno.h>
+#include <unistd.h>
+#endif
+
 #ifdef ARDUINO
 #include "bc-crypto-base.h"
 #else
@@ -34,6 +45,9 @@ typedef struct context_t {
     uint16_t mid;
     uint16_t hi;
 
+    uint8_t k;
+    uint8_t keypad_digits;
+
     size_t payload_byte_count;
     size_t payload_word_count;
 
@@ -44,40 +58,44 @@ typedef struct context_t {
 
 void* bip39_new_context() {
     size_t context_len = sizeof(context);
-    context* ctx = calloc(context_len, 1);
+    context* ctx = bip39_secure_alloc(context_len);
+    if (ctx == NULL) {
+        return NULL;
+    }
     ctx->payload_byte_count = 32;
     ctx->payload_word_count = 24;
     return ctx;
 }
 
-void bip39_dispose_context(void* ctx) { free(ctx); }
+void bip39_dispose_context(void* ctx) { bip39_secure_free(ctx, sizeof(context)); }
 
+// Binary search of a flash-resident index table. Only the 16-bit index of
+// each probe and the final character are read from flash; on AVR this avoids
+// copying a whole `index_char` out of program memory at every step.
 static char lookup(const index_char* table, uint8_t length, uint16_t n) {
     uint8_t lo = 0;
     uint8_t hi = length;
     uint8_t mid;
-    static index_char m;
 
     while (lo + 1 < hi) {
         mid = (lo + hi) / 2;
-        MEMCPY_P(&m, &(table[mid]), sizeof(index_char));
-        if (m.i < n) {
+        uint16_t i = PGM_READ_WORD(&table[mid].i);
+        if (i < n) {
             lo = mid;
-        } else if (m.i > n) {
+        } else if (i > n) {
             hi = mid;
         } else {
             lo = mid;
             break;
         }
     }
-    MEMCPY_P(&m, &table[lo], sizeof(index_char));
-    return m.c;
+    return PGM_READ_BYTE(&table[lo].c);
 }
 
-static void load_mnemonic(uint16_t i, char* b) {
+void bip39_load_mnemonic(uint16_t i, char* b) {
     b[0] = lookup(bip39_prefix1, PREFIX_1_LEN, i);
     b[1] = lookup(bip39_prefix2, PREFIX_2_LEN, i);
-    STRCPY_P(b + 2, bip39_suffix[i]);
+    STRCPY_P(b + 2, BIP39_SUFFIX(i));
 }
 
 const char* bip39_get_mnemonic(void* ctx, uint16_t i) {
@@ -85,12 +103,16 @@ const char* bip39_get_mnemonic(void* ctx, uint16_t i) {
         return NULL;
     }
     context* c = ctx;
-    load_mnemonic(i, c->wordBuf);
+    bip39_load_mnemonic(i, c->wordBuf);
     return c->wordBuf;
 }
 
 void bip39_mnemonic_from_word(uint16_t word, char* mnemonic) {
   context* ctx = bip39_new_context();
+  if(ctx == NULL) {
+      mnemonic[0] = '\0';
+      return;
+  }
   const char* string = bip39_get_mnemonic(ctx, word);
   if(string == NULL) {
       mnemonic[0] = '\0';
@@ -105,23 +127,23 @@ void bip39_start_search(void* ctx) {
     c->lo = 0;
     c->hi = 2048;
     c->mid = (c->lo + c->hi) / 2;
-    load_mnemonic(c->lo, c->wordBuf);
-    load_mnemonic(c->mid, c->wordBufHi);
+    bip39_load_mnemonic(c->lo, c->wordBuf);
+    bip39_load_mnemonic(c->mid, c->wordBufHi);
 }
 
 void bip39_choose_low(void* ctx) {
     context* c = ctx;
     c->hi = c->mid;
     c->mid = (c->lo + c->hi) / 2;
-    load_mnemonic(c->mid, c->wordBufHi);
+    bip39_load_mnemonic(c->mid, c->wordBufHi);
 }
 
 void bip39_choose_high(void* ctx) {
     context* c = ctx;
     c->lo = c->mid;
     c->mid = (c->lo + c->hi) / 2;
-    load_mnemonic(c->lo, c->wordBuf);
-    load_mnemonic(c->mid, c->wordBufHi);
+    bip39_load_mnemonic(c->lo, c->wordBuf);
+    bip39_load_mnemonic(c->mid, c->wordBufHi);
 }
 
 const char* bip39_get_low(const void* ctx) {
@@ -144,6 +166,92 @@ const uint16_t bip39_selected_word(const void* ctx) {
     return c->lo;
 }
 
+void bip39_start_kway_search(void* ctx, uint8_t k) {
+    context* c = ctx;
+    c->k = k < 2 ? 2 : k;
+    c->lo = 0;
+    c->hi = 2048;
+    c->mid = (c->lo + c->hi) / 2;
+}
+
+uint16_t bip39_kway_branch_start(const void* ctx, uint8_t branch) {
+    const context* c = ctx;
+    return c->lo + (uint32_t)(c->hi - c->lo) * branch / c->k;
+}
+
+void bip39_choose_kway(void* ctx, uint8_t branch) {
+    context* c = ctx;
+    if (branch >= c->k) {
+        return;
+    }
+    uint16_t lo = bip39_kway_branch_start(ctx, branch);
+    uint16_t hi = bip39_kway_branch_start(ctx, branch + 1);
+    if (lo == hi) {
+        return;
+    }
+    c->lo = lo;
+    c->hi = hi;
+    c->mid = (c->lo + c->hi) / 2;
+}
+
+// While a keypad search is active, `lo` and `hi` delimit the candidates as a
+// range of positions in the keypad-ordered tables, not as word numbers.
+void bip39_start_keypad_search(void* ctx) {
+    context* c = ctx;
+    c->lo = 0;
+    c->hi = 2048;
+    c->keypad_digits = 0;
+}
+
+static uint8_t keypad_digit_at(uint16_t position, uint8_t n) {
+    uint32_t key = PGM_READ_DWORD(&bip39_keypad_keys[position]);
+    return (key >> (28 - 4 * n)) & 0x0F;
+}
+
+// Returns the first position in [lo, hi) whose nth digit is at least `digit`.
+static uint16_t keypad_lower_bound(uint16_t lo, uint16_t hi, uint8_t n, uint8_t digit) {
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if (keypad_digit_at(mid, n) < digit) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+bool bip39_keypad_press(void* ctx, char key) {
+    context* c = ctx;
+    if (key < '2' || key > '9' || c->keypad_digits >= 8) {
+        return false;
+    }
+    uint8_t digit = key - '1';
+    uint8_t n = c->keypad_digits;
+    uint16_t lo = keypad_lower_bound(c->lo, c->hi, n, digit);
+    uint16_t hi = keypad_lower_bound(lo, c->hi, n, digit + 1);
+    if (lo == hi) {
+        return false;
+    }
+    c->lo = lo;
+    c->hi = hi;
+    c->keypad_digits++;
+    return true;
+}
+
+size_t bip39_keypad_candidate_count(const void* ctx) {
+    const context* c = ctx;
+    return c->hi - c->lo;
+}
+
+uint16_t bip39_keypad_candidate(const void* ctx, size_t n) {
+    const context* c = ctx;
+    if (n >= c->hi - c->lo) {
+        return 0xFFFF;
+    }
+    return PGM_READ_WORD(&bip39_keypad_words[c->lo + n]);
+}
+
 // NOTE that there is something fishy here.
 // 25 * 8 = 200 / 11
 void bip39_set_byte_count(void* ctx, size_t bytes) {
@@ -168,30 +276,29 @@ uint8_t bip39_get_byte_count(const void* ctx) {
     return c->payload_byte_count;
 }
 
-static uint8_t* compute_checksum(const void* ctx) {
+static void compute_checksum(const void* ctx, uint8_t* digest) {
     const context* c = ctx;
-
-    uint8_t* digest = malloc(SHA256_DIGEST_LENGTH);
     sha256_Raw(c->buffer, c->payload_byte_count, digest);
-    return digest;
 }
 
 void bip39_append_checksum(void* ctx) {
     context* c = ctx;
 
-    uint8_t* res = compute_checksum(ctx);
+    uint8_t res[SHA256_DIGEST_LENGTH];
+    compute_checksum(ctx, res);
 
     c->buffer[c->payload_byte_count] = res[0];
     c->buffer[c->payload_byte_count + 1] = res[1];
 
-    free(res);
+    memzero(res, sizeof(res));
 }
 
 bool bip39_verify_checksum(const void* ctx) {
     const context* c = ctx;
 
     uint8_t checksum_bits = 11 - ((c->payload_byte_count * 8) % 11);
-    uint8_t* res = compute_checksum(ctx);
+    uint8_t res[SHA256_DIGEST_LENGTH];
+    compute_checksum(ctx, res);
 
     uint8_t mask;
 
@@ -207,7 +314,7 @@ bool bip39_verify_checksum(const void* ctx) {
             (c->buffer[c->payload_byte_count + 1] & mask) == (res[1] & mask);
     }
 
-    free(res);
+    memzero(res, sizeof(res));
 
     return result;
 }
@@ -310,8 +417,8 @@ void bip39_set_bytes(void* ctx, const uint8_t* bytes, size_t length) {
 
 int16_t find_in_prefix_1(char c) {
     for (int i = 0; i < PREFIX_1_LEN; i++) {
-        if (bip39_prefix1[i].c == c) {
-            return bip39_prefix1[i].i;
+        if (PGM_READ_BYTE(&bip39_prefix1[i].c) == c) {
+            return PGM_READ_WORD(&bip39_prefix1[i].i);
         }
     }
     return -1;
@@ -321,14 +428,14 @@ void find_in_prefix_2(char c, int16_t start_index, int16_t* i1, int16_t* i2) {
     int lo = 0;
     int hi = PREFIX_2_LEN;
     int mid;
-    index_char m;
+    uint16_t i = 0;
 
     while (lo < hi) {
         mid = (lo + hi) / 2;
-        MEMCPY_P(&m, &(bip39_prefix2[mid]), sizeof(index_char));
-        if (m.i < start_index) {
+        i = PGM_READ_WORD(&bip39_prefix2[mid].i);
+        if (i < start_index) {
             lo = mid;
-        } else if (m.i > start_index) {
+        } else if (i > start_index) {
             hi = mid;
         } else {
             lo = mid;
@@ -336,37 +443,104 @@ void find_in_prefix_2(char c, int16_t start_index, int16_t* i1, int16_t* i2) {
         }
     }
 
-    while (m.c < c) {
+    char m = PGM_READ_BYTE(&bip39_prefix2[lo].c);
+    while (m < c) {
         lo += 1;
         if (lo == PREFIX_2_LEN) {
             *i1 = -1;
             return;
         }
-        MEMCPY_P(&m, &(bip39_prefix2[lo]), sizeof(index_char));
+        // Second letters ascend within a first letter's group, so a drop
+        // means the search has run into the next group.
+        char next = PGM_READ_BYTE(&bip39_prefix2[lo].c);
+        if (next <= m) {
+            *i1 = -1;
+            return;
+        }
+        m = next;
     }
 
-    if (m.c == c) {
-        *i1 = m.i;
+    if (m == c) {
+        *i1 = PGM_READ_WORD(&bip39_prefix2[lo].i);
         if (lo == PREFIX_2_LEN - 1) {
             *i2 = 2048;
         } else {
-            MEMCPY_P(&m, &(bip39_prefix2[lo + 1]), sizeof(index_char));
-            *i2 = m.i;
+            *i2 = PGM_READ_WORD(&bip39_prefix2[lo + 1].i);
         }
     } else {
         *i1 = -1;
     }
 }
 
+static bool suffix_equals(const char* s, size_t len, const char* suffix) {
+    for (size_t i = 0; i < len; i++) {
+        char c = PGM_READ_BYTE(suffix + i);
+        if (c == '\0' || c != s[i]) {
+            return false;
+        }
+    }
+    return PGM_READ_BYTE(suffix + len) == '\0';
+}
+
+// Accepts a word's first three or four letters (all of a three-letter
+// word), or the whole word.
+static int16_t word_from_abbreviation_len(const char* abbreviation, size_t len) {
+    if (len < 3 || len > 8) {
+        return -1;
+    }
+    uint32_t key = 0;
+    for (size_t i = 0; i < 4; i++) {
+        uint8_t letter = 0;
+        if (i < len) {
+            char c = abbreviation[i];
+            if (c < 'a' || c > 'z') {
+                return -1;
+            }
+            letter = c - 'a' + 1;
+        }
+        key = key * 27 + letter;
+    }
+
+    uint32_t h = key * BIP39_ABBREV_MULTIPLIER;
+    uint16_t displacement = PGM_READ_WORD(&bip39_abbrev_displacements[h >> 22]);
+    uint32_t slot = PGM_READ_DWORD(&bip39_abbrev_slots[((h >> 11) & 0x7FF) ^ displacement]);
+    if (slot >> 11 != key) {
+        return -1;
+    }
+    int16_t w = slot & 0x7FF;
+    if (len > 4 && !suffix_equals(abbreviation + 2, len - 2, BIP39_SUFFIX(w))) {
+        return -1;
+    }
+    return w;
+}
+
 int16_t bip39_word_from_mnemonic(const char* mnemonic) {
     if (mnemonic == NULL) {
         return -1;
     }
-    if (strlen(mnemonic) < 3) {
+    return bip39_word_from_mnemonic_len(mnemonic, strlen(mnemonic));
+}
+
+int16_t bip39_word_from_mnemonic_len(const char* mnemonic, size_t mnemonic_len) {
+#if !defined(ARDUINO) && !defined(__AVR__)
+    return bip39_word_from_mnemonic_constant_time(mnemonic, mnemonic_len);
+#else
+    return bip39_table_word_from_mnemonic_len(mnemonic, mnemonic_len);
+#endif
+}
+
+int16_t bip39_table_word_from_mnemonic_len(const char* mnemonic, size_t mnemonic_len) {
+    if (mnemonic == NULL) {
+        return -1;
+    }
+    if (mnemonic_len < 3 || mnemonic_len > 8) {
         return -1;
     }
     char c0 = mnemonic[0];
     int16_t start_index = find_in_prefix_1(c0);
+    if (start_index == -1) {
+        return -1;
+    }
     char c1 = mnemonic[1];
     int16_t i1, i2;
     find_in_prefix_2(c1, start_index, &i1, &i2);
@@ -375,14 +549,20 @@ int16_t bip39_word_from_mnemonic(const char* mnemonic) {
         return -1;
     }
     for (int i = i1; i < i2; i++) {
-        const char* s2 = bip39_suffix[i];
-        if (strcmp(s1, s2) == 0) {
+        if (suffix_equals(s1, mnemonic_len - 2, BIP39_SUFFIX(i))) {
             return i;
         }
     }
     return -1;
 }
 
+int16_t bip39_word_from_abbreviation(const char* abbreviation) {
+    if (abbreviation == NULL) {
+        return -1;
+    }
+    return word_from_abbreviation_len(abbreviation, strlen(abbreviation));
+}
+
 void bip39_set_payload(void* ctx, size_t length, const uint8_t* bytes) {
     if (length > BIP39_BUF_MAX) {
         return;
@@ -404,7 +584,23 @@ size_t bip39_words_from_secret(const uint8_t* secret, size_t secret_len, uint16_
         return 0;
     }
 
+    const bip39_kernel* kernel = bip39_kernel_for_secret_len(secret_len);
+    if (kernel != NULL) {
+        if (max_words_len >= kernel->words_len) {
+            kernel->encode(secret, words);
+        } else {
+            uint16_t all_words[24];
+            kernel->encode(secret, all_words);
+            memcpy(words, all_words, max_words_len * sizeof(uint16_t));
+            memzero(all_words, sizeof(all_words));
+        }
+        return kernel->words_len;
+    }
+
     void* ctx = bip39_new_context();
+    if (ctx == NULL) {
+        return 0;
+    }
 
     bip39_set_byte_count(ctx, secret_len);
     bip39_set_payload(ctx, secret_len, secret);
@@ -420,58 +616,98 @@ size_t bip39_words_from_secret(const uint8_t* secret, size_t secret_len, uint16_
     return words_len;
 }
 
+// Kept out of line so the digest is off the stack while words are emitted.
+__attribute__((noinline))
+static uint8_t checksum_byte(const uint8_t* secret, size_t secret_len) {
+    uint8_t hash[SHA256_DIGEST_LENGTH];
+    sha256_Raw(secret, secret_len, hash);
+    uint8_t checksum = hash[0];
+    memzero(hash, sizeof(hash));
+    return checksum;
+}
+
+size_t bip39_emit_words_from_secret(const uint8_t* secret, size_t secret_len, bip39_emit_callback emit, void* user_data) {
+    if (secret_len % 4 != 0 || secret_len < 8 || secret_len > 32) {
+        return 0;
+    }
+    // The checksum byte follows the secret; only its top secret_len / 4
+    // bits fall inside the last word.
+    uint8_t checksum = checksum_byte(secret, secret_len);
+    size_t words_len = secret_len * 3 / 4;
+    char mnemonic[9];
+    for (size_t i = 0; i < words_len; i++) {
+        size_t offset = i * 11;
+        uint32_t bits = 0;
+        for (size_t j = offset / 8; j < offset / 8 + 3; j++) {
+            bits = bits << 8 | (j < secret_len ? secret[j] : j == secret_len ? checksum : 0);
+        }
+        uint16_t word = (bits >> (24 - 11 - offset % 8)) & 0x7FF;
+        bip39_load_mnemonic(word, mnemonic);
+        emit(i, word, mnemonic, user_data);
+    }
+    memzero(mnemonic, sizeof(mnemonic));
+    return words_len;
+}
+
 size_t bip39_mnemonics_from_secret(const uint8_t* secret, size_t secret_len, char* mnemonics, size_t max_mnemonics_len) {
     if(max_mnemonics_len == 0) { return 0; }
 
     size_t max_words_len = 40;
-    uint16_t words[max_words_len];
+    uint16_t* words = bip39_secure_alloc(max_words_len * sizeof(uint16_t));
+    if (words == NULL) {
+        return 0;
+    }
     size_t words_len = bip39_words_from_secret(secret, secret_len, words, max_words_len);
     if(words_len == 0) {
+        bip39_secure_free(words, max_words_len * sizeof(uint16_t));
         return 0;
     }
 
-    char string[300];
-    string[0] = '\0';
+    size_t max_string_len = 300;
+    char* string = bip39_secure_alloc(max_string_len);
+    if (string == NULL) {
+        bip39_secure_free(words, max_words_len * sizeof(uint16_t));
+        return 0;
+    }
+    size_t mnemonics_len = 0;
     for (int i = 0; i < words_len; i++) {
         if (i != 0) {
-            strcat(string, " ");
+            string[mnemonics_len++] = ' ';
         }
-        char mnemonic[20];
-        bip39_mnemonic_from_word(words[i], mnemonic);
-        strcat(string, mnemonic);
+        bip39_mnemonic_from_word(words[i], string + mnemonics_len);
+        mnemonics_len += strlen(string + mnemonics_len);
     }
-    size_t mnemonics_len = strlen(string);
+    bip39_secure_free(words, max_words_len * sizeof(uint16_t));
 
     if (mnemonics_len > max_mnemonics_len - 1) {
+        bip39_secure_free(string, max_string_len);
         return 0;
     }
     strcpy(mnemonics, string);
+    bip39_secure_free(string, max_string_len);
 
     return mnemonics_len;
 }
 
-size_t bip39_words_from_mnemonics(const char* mnemonics, uint16_t* words, size_t max_words_len) {
+static bool is_mnemonic_char(char c) {
+    return c >= 'a' && c <= 'z';
+}
+
+typedef int16_t (*word_lookup)(const char* mnemonic, size_t mnemonic_len);
+
+static size_t words_from_mnemonics(const char* mnemonics, size_t mnemonics_len, word_lookup lookup_word, uint16_t* words, size_t max_words_len) {
     const char* p = mnemonics;
-    size_t max_buf_len = 16;
-    char buf[max_buf_len];
-
-    int words_len = 0;
-    while(*p != '\0') {
-        int buf_len;
-        for(buf_len = 0; *p >= 'a' && *p <= 'z'; buf_len++, p++) {
-            if(buf_len < (max_buf_len - 1)) {
-                buf[buf_len] = *p;
-            } else {
-                buf[buf_len] = 0;
-            }
-        }
+    const char* end = mnemonics + mnemonics_len;
 
-        if(buf_len < 15) {
-            buf[buf_len] = '\0';
+    size_t words_len = 0;
+    while(p < end) {
+        const char* word = p;
+        while(p < end && is_mnemonic_char(*p)) {
+            p++;
         }
 
         if(words_len < max_words_len) {
-            int16_t w = bip39_word_from_mnemonic(buf);
+            int16_t w = lookup_word(word, p - word);
             if (w < 0) {
                 return 0;
             } else {
@@ -481,26 +717,150 @@ size_t bip39_words_from_mnemonics(const char* mnemonics, uint16_t* words, size_t
 
         words_len++;
 
-        while(*p != '\0' && (*p < 'a' || *p > 'z')) {
+        while(p < end && !is_mnemonic_char(*p)) {
             p++;
         }
     }
     return words_len;
 }
 
+size_t bip39_words_from_mnemonics(const char* mnemonics, uint16_t* words, size_t max_words_len) {
+    return words_from_mnemonics(mnemonics, strlen(mnemonics), bip39_word_from_mnemonic_len, words, max_words_len);
+}
+
+size_t bip39_words_from_mnemonics_len(const char* mnemonics, size_t mnemonics_len, uint16_t* words, size_t max_words_len) {
+    return words_from_mnemonics(mnemonics, mnemonics_len, bip39_word_from_mnemonic_len, words, max_words_len);
+}
+
+size_t bip39_words_from_abbreviated_mnemonics(const char* mnemonics, uint16_t* words, size_t max_words_len) {
+    return words_from_mnemonics(mnemonics, strlen(mnemonics), word_from_abbreviation_len, words, max_words_len);
+}
+
+#define MAX_WORD_LEN 8
+
+int bip39_parse_words(const char* mnemonics, size_t mnemonics_len, size_t max_bytes, size_t max_word_len, uint16_t* words, size_t max_words_len, size_t* words_len) {
+    *words_len = 0;
+    if (mnemonics_len > max_bytes) {
+        return BIP39_PARSE_TOO_LONG;
+    }
+    // No word is longer than eight letters, so a longer token is an unknown
+    // word whatever the limit, and is rejected without a lookup.
+    int long_word_result = BIP39_PARSE_WORD_TOO_LONG;
+    if (max_word_len > MAX_WORD_LEN) {
+        max_word_len = MAX_WORD_LEN;
+        long_word_result = BIP39_PARSE_UNKNOWN_WORD;
+    }
+
+    const char* p = mnemonics;
+    const char* end = mnemonics + mnemonics_len;
+    size_t count = 0;
+    int result = BIP39_PARSE_OK;
+    while (p < end && result == BIP39_PARSE_OK) {
+        if (!is_mnemonic_char(*p)) {
+            p++;
+            continue;
+        }
+        const char* word = p;
+        const char* word_end = (size_t)(end - p) > max_word_len ? p + max_word_len : end;
+        while (p < word_end && is_mnemonic_char(*p)) {
+            p++;
+        }
+        if (p < end && is_mnemonic_char(*p)) {
+            result = long_word_result;
+        } else if (count == max_words_len) {
+            result = BIP39_PARSE_TOO_MANY_WORDS;
+        } else {
+            int16_t w = bip39_word_from_mnemonic_len(word, p - word);
+            if (w < 0) {
+                result = BIP39_PARSE_UNKNOWN_WORD;
+            } else {
+                words[count++] = w;
+            }
+        }
+    }
+    if (result == BIP39_PARSE_OK && count == 0) {
+        result = BIP39_PARSE_EMPTY;
+    }
+    if (result != BIP39_PARSE_OK) {
+        memzero(words, count * sizeof(uint16_t));
+        count = 0;
+    }
+    *words_len = count;
+    return result;
+}
+
+int bip39_parse_secret(const char* mnemonics, size_t mnemonics_len, size_t max_bytes, size_t max_word_len, uint8_t* secret, size_t* secret_len) {
+    uint16_t words[24];
+    size_t words_len;
+    *secret_len = 0;
+    int result = bip39_parse_words(mnemonics, mnemonics_len, max_bytes, max_word_len, words, 24, &words_len);
+    if (result == BIP39_PARSE_OK) {
+        const bip39_kernel* kernel = bip39_kernel_for_words_len(words_len);
+        if (kernel == NULL) {
+            result = BIP39_PARSE_BAD_LENGTH;
+        } else if (!kernel->decode(words, secret)) {
+            memzero(secret, kernel->secret_len);
+            result = BIP39_PARSE_BAD_CHECKSUM;
+        } else {
+            *secret_len = kernel->secret_len;
+        }
+    }
+    memzero(words, sizeof(words));
+    return result;
+}
+
+static size_t secret_from_mnemonics(const char* mnemonics, size_t mnemonics_len, word_lookup lookup_word, uint8_t* secret, size_t max_secret_len);
+
 size_t bip39_secret_from_mnemonics(const char* mnemonics, uint8_t* secret, size_t max_secret_len) {
+    return secret_from_mnemonics(mnemonics, strlen(mnemonics), bip39_word_from_mnemonic_len, secret, max_secret_len);
+}
+
+size_t bip39_secret_from_mnemonics_len(const char* mnemonics, size_t mnemonics_len, uint8_t* secret, size_t max_secret_len) {
+    return secret_from_mnemonics(mnemonics, mnemonics_len, bip39_word_from_mnemonic_len, secret, max_secret_len);
+}
+
+size_t bip39_secret_from_abbreviated_mnemonics(const char* mnemonics, uint8_t* secret, size_t max_secret_len) {
+    return secret_from_mnemonics(mnemonics, strlen(mnemonics), word_from_abbreviation_len, secret, max_secret_len);
+}
+
+static size_t secret_from_mnemonics(const char* mnemonics, size_t mnemonics_len, word_lookup lookup_word, uint8_t* secret, size_t max_secret_len) {
     size_t max_words_len = 30;
-    uint16_t words[max_words_len];
-    size_t words_len = bip39_words_from_mnemonics(mnemonics, words, max_words_len);
-    if (words_len == 0) {
+    uint16_t* words = bip39_secure_alloc(max_words_len * sizeof(uint16_t));
+    if (words == NULL) {
         return 0;
     }
+    size_t words_len = words_from_mnemonics(mnemonics, mnemonics_len, lookup_word, words, max_words_len);
+    if (words_len == 0 || words_len > max_words_len) {
+        bip39_secure_free(words, max_words_len * sizeof(uint16_t));
+        return 0;
+    }
+
+    const bip39_kernel* kernel = bip39_kernel_for_words_len(words_len);
+    if (kernel != NULL) {
+        size_t secret_len = 0;
+        if (kernel->secret_len <= max_secret_len) {
+            uint8_t decoded[32];
+            if (kernel->decode(words, decoded)) {
+                memcpy(secret, decoded, kernel->secret_len);
+                secret_len = kernel->secret_len;
+            }
+            memzero(decoded, sizeof(decoded));
+        }
+        bip39_secure_free(words, max_words_len * sizeof(uint16_t));
+        return secret_len;
+    }
+
     void* ctx = bip39_new_context();
+    if (ctx == NULL) {
+        bip39_secure_free(words, max_words_len * sizeof(uint16_t));
+        return 0;
+    }
 
     bip39_set_word_count(ctx, words_len);
     for(int i = 0; i < words_len; i++) {
         bip39_set_word(ctx, i, words[i]);
     }
+    bip39_secure_free(words, max_words_len * sizeof(uint16_t));
     size_t secret_len = bip39_get_byte_count(ctx);
     if(secret_len > max_secret_len) {
         goto fail;
@@ -519,6 +879,187 @@ size_t bip39_secret_from_mnemonics(const char* mnemonics, uint8_t* secret, size_
     return 0;
 }
 
+size_t bip39_valid_final_words(const uint16_t* words, size_t words_len, uint16_t* final_words, size_t max_final_words_len) {
+    // The full phrase carries one checksum bit per three words, all of which
+    // land in the last word; the rest of that word is free entropy.
+    size_t phrase_len = words_len + 1;
+    if (phrase_len % 3 != 0 || phrase_len < 6 || phrase_len > 24) {
+        return 0;
+    }
+    uint8_t checksum_bits = phrase_len / 3;
+    uint16_t candidates_len = 1 << (11 - checksum_bits);
+    // Checked before any word reaches the context, so there is nothing to
+    // wipe on the way out.
+    for (size_t i = 0; i < words_len; i++) {
+        if (words[i] > 2047) {
+            return 0;
+        }
+    }
+
+    context ctx;
+    bip39_clear(&ctx);
+    bip39_set_word_count(&ctx, phrase_len);
+    for (size_t i = 0; i < words_len; i++) {
+        bip39_set_word(&ctx, i, words[i]);
+    }
+
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    for (uint16_t i = 0; i < candidates_len && i < max_final_words_len; i++) {
+        uint16_t word = i << checksum_bits;
+        bip39_set_word(&ctx, words_len, word);
+        compute_checksum(&ctx, digest);
+        final_words[i] = word | (digest[0] >> (8 - checksum_bits));
+    }
+
+    memzero(&ctx, sizeof(ctx));
+    memzero(digest, sizeof(digest));
+
+    return candidates_len;
+}
+
 void bip39_seed_from_string(const char* string, uint8_t* seed) {
     sha256_Raw((uint8_t*)string, strlen(string), seed);
 }
+
+void* bip39_new_seed_stream() {
+    SHA256_CTX* stream = bip39_secure_alloc(sizeof(SHA256_CTX));
+    if (stream == NULL) {
+        return NULL;
+    }
+    sha256_Init(stream);
+    return stream;
+}
+
+void bip39_dispose_seed_stream(void* stream) {
+    bip39_secure_free(stream, sizeof(SHA256_CTX));
+}
+
+void bip39_seed_stream_update(void* stream, const uint8_t* bytes, size_t length) {
+    sha256_Update(stream, bytes, length);
+}
+
+void bip39_seed_stream_final(void* stream, uint8_t* seed) {
+    sha256_Final(stream, seed);
+    sha256_Init(stream);
+}
+
+bool bip39_seed_from_mnemonics(const char* mnemonics, const char* passphrase, uint8_t* seed) {
+    if (passphrase == NULL) {
+        passphrase = "";
+    }
+    size_t passphrase_len = strlen(passphrase);
+    size_t salt_len = 8 + passphrase_len;
+    uint8_t* salt = bip39_secure_alloc(salt_len);
+    if (salt == NULL) {
+        memzero(seed, BIP39_MNEMONIC_SEED_LEN);
+        return false;
+    }
+    memcpy(salt, "mnemonic", 8);
+    memcpy(salt + 8, passphrase, passphrase_len);
+
+    pbkdf2_hmac_sha512((const uint8_t*)mnemonics, strlen(mnemonics), salt, salt_len,
+        BIP39_PBKDF2_ROUNDS, seed, BIP39_MNEMONIC_SEED_LEN);
+
+    bip39_secure_free(salt, salt_len);
+    return true;
+}
+
+#if !defined(ARDUINO) && !defined(__AVR__)
+
+// Entropy is read from the OS in blocks of this size and split across
+// phrases, so generating a batch costs one syscall per block rather than
+// one per phrase.
+#define BIP39_ENTROPY_BLOCK_LEN 4096
+
+size_t bip39_generate_words_batch(size_t secret_len, size_t count, uint16_t* words) {
+    const bip39_kernel* kernel = bip39_kernel_for_secret_len(secret_len);
+    if (kernel == NULL) {
+        return 0;
+    }
+
+    uint8_t block[BIP39_ENTROPY_BLOCK_LEN];
+    size_t block_len = 0;
+    size_t block_pos = 0;
+
+    size_t generated;
+    for (generated = 0; generated < count; generated++) {
+        if (block_pos + secret_len > block_len) {
+            size_t remaining = (count - generated) * secret_len;
+            block_len = sizeof(block) - sizeof(block) % secret_len;
+            if (remaining < block_len) {
+                block_len = remaining;
+            }
+            if (!bip39_random_bytes(block, block_len)) {
+                break;
+            }
+            block_pos = 0;
+        }
+        kernel->encode(block + block_pos, words + generated * kernel->words_len);
+        block_pos += secret_len;
+    }
+
+    memzero(block, sizeof(block));
+
+    return generated;
+}
+
+size_t bip39_generate_words(size_t secret_len, uint16_t* words, size_t max_words_len) {
+    uint16_t phrase[24];
+    if (bip39_generate_words_batch(secret_len, 1, phrase) != 1) {
+        return 0;
+    }
+    size_t words_len = secret_len * 3 / 4;
+    for (size_t i = 0; i < words_len && i < max_words_len; i++) {
+        words[i] = phrase[i];
+    }
+    memzero(phrase, sizeof(phrase));
+    return words_len;
+}
+
+size_t bip39_generate_mnemonics(size_t secret_len, char* mnemonics, size_t max_mnemonics_len) {
+    if (bip39_kernel_for_secret_len(secret_len) == NULL) {
+        return 0;
+    }
+    uint8_t secret[32];
+    if (!bip39_random_bytes(secret, secret_len)) {
+        return 0;
+    }
+    size_t mnemonics_len = bip39_mnemonics_from_secret(secret, secret_len, mnemonics, max_mnemonics_len);
+    memzero(secret, sizeof(secret));
+    return mnemonics_len;
+}
+
+// Large enough that the per-read overhead vanishes next to the hashing.
+#define BIP39_SEED_READ_BLOCK_LEN (64 * 1024)
+
+bool bip39_seed_from_fd(int fd, uint8_t* seed) {
+    uint8_t* block = malloc(BIP39_SEED_READ_BLOCK_LEN);
+    if (block == NULL) {
+        memzero(seed, BIP39_SEED_LEN);
+        return false;
+    }
+    SHA256_CTX stream;
+    sha256_Init(&stream);
+    bool result = true;
+    for (;;) {
+        ssize_t n = read(fd, block, BIP39_SEED_READ_BLOCK_LEN);
+        if (n > 0) {
+            sha256_Update(&stream, block, n);
+        } else if (n == 0) {
+            break;
+        } else if (errno != EINTR) {
+            result = false;
+            break;
+        }
+    }
+    sha256_Final(&stream, seed);
+    if (!result) {
+        memzero(seed, BIP39_SEED_LEN);
+    }
+    memzero(&stream, sizeof(stream));
+    memzero(block, BIP39_SEED_READ_BLOCK_LEN);
+    free(block);
+    return result;
+}
+
+#endif /* ARDUINO */
@@ -25,6 +25,17 @@ size_t bip39_words_from_secret(const uint8_t* secret, size_t secret_len, uint16_
 // Returns the length of the string written.
 size_t bip39_mnemonics_from_secret(const uint8_t* secret, size_t secret_len, char* mnemonics, size_t max_mnemonics_len);
 
+// Hands the words for the given secret to `emit` one at a time, in order,
+// with each word's English mnemonic, so the phrase is never held in memory.
+// Its own frame is 112 bytes on x86-64 at -Os (see `make -C src
+// stack-usage`), mostly callee-saved registers holding the loop state
+// across the callback, whose frame comes on top. The checksum's SHA-256
+// runs in a separate frame that is released before the first word.
+// Returns the number of words emitted, or 0 if `secret_len` is not a
+// multiple of 4 from 8 to 32.
+typedef void (*bip39_emit_callback)(size_t index, uint16_t word, const char* mnemonic, void* user_data);
+size_t bip39_emit_words_from_secret(const uint8_t* secret, size_t secret_len, bip39_emit_callback emit, void* user_data);
+
 // Writes out the BIP39 words for the given English mnemonics.
 // Returns the number of words written.
 size_t bip39_words_from_mnemonics(const char* mnemonics, uint16_t* words, size_t max_words_len);
@@ -33,15 +44,175 @@ size_t bip39_words_from_mnemonics(const char* mnemonics, uint16_t* words, size_t
 // Returns the number of bytes written.
 size_t bip39_secret_from_mnemonics(const char* mnemonics, uint8_t* secret, size_t max_secret_len);
 
+// Length-delimited forms of `bip39_word_from_mnemonic`,
+// `bip39_words_from_mnemonics` and `bip39_secret_from_mnemonics`, for
+// phrases borrowed from larger buffers. They read exactly `len` bytes and never look for a
+// terminating NUL. In a phrase, any byte other than 'a'-'z' separates words.
+int16_t bip39_word_from_mnemonic_len(const char* mnemonic, size_t mnemonic_len);
+size_t bip39_words_from_mnemonics_len(const char* mnemonics, size_t mnemonics_len, uint16_t* words, size_t max_words_len);
+size_t bip39_secret_from_mnemonics_len(const char* mnemonics, size_t mnemonics_len, uint8_t* secret, size_t max_secret_len);
+
+// Strict forms of the length-delimited parsers, for untrusted input. The
+// phrase is rejected before it is scanned if it is longer than `max_bytes`,
+// and scanning stops at the first token longer than `max_word_len` or
+// beyond `max_words_len` tokens, or at the first unknown word, so the cost
+// is bounded by the limits rather than by the input. Tokens are separated
+// as above. Returns BIP39_PARSE_OK, setting `words_len` (or `secret_len`),
+// or the reason the phrase was rejected, setting it to 0.
+#define BIP39_PARSE_OK 0
+#define BIP39_PARSE_EMPTY 1
+#define BIP39_PARSE_TOO_LONG 2
+#define BIP39_PARSE_WORD_TOO_LONG 3
+#define BIP39_PARSE_TOO_MANY_WORDS 4
+#define BIP39_PARSE_UNKNOWN_WORD 5
+#define BIP39_PARSE_BAD_LENGTH 6
+#define BIP39_PARSE_BAD_CHECKSUM 7
+int bip39_parse_words(const char* mnemonics, size_t mnemonics_len, size_t max_bytes, size_t max_word_len, uint16_t* words, size_t max_words_len, size_t* words_len);
+
+// Also fails with BIP39_PARSE_BAD_LENGTH unless the phrase has 12, 15, 18,
+// 21 or 24 words, and with BIP39_PARSE_BAD_CHECKSUM. `secret` holds 32
+// bytes.
+int bip39_parse_secret(const char* mnemonics, size_t mnemonics_len, size_t max_bytes, size_t max_word_len, uint8_t* secret, size_t* secret_len);
+
+#if !defined(ARDUINO) && !defined(__AVR__)
+
+// Looks a word up by comparing it against every word in the list, with no
+// branches or memory accesses that depend on its letters; only its length
+// shows in the timing. This is what the functions above use, except on
+// Arduino, where they walk the prefix tables instead.
+int16_t bip39_word_from_mnemonic_constant_time(const char* mnemonic, size_t mnemonic_len);
+
+#endif
+
+// Abbreviation-aware forms of `bip39_word_from_mnemonic`,
+// `bip39_words_from_mnemonics` and `bip39_secret_from_mnemonics`, for
+// backups that keep only each word's first four letters. A word may be
+// given by its first four letters, by all of a three-letter word, or in
+// full; no two words share their first four letters.
+int16_t bip39_word_from_abbreviation(const char* abbreviation);
+size_t bip39_words_from_abbreviated_mnemonics(const char* mnemonics, uint16_t* words, size_t max_words_len);
+size_t bip39_secret_from_abbreviated_mnemonics(const char* mnemonics, uint8_t* secret, size_t max_secret_len);
+
+// Writes out every word that completes the given phrase with a valid
+// checksum, in ascending order. `words_len` is one less than a valid phrase
+// length (5, 8, 11, ... 23). Returns the number of valid final words (128
+// for 11 words, 8 for 23), or 0 if `words_len` or any word is out of range.
+size_t bip39_valid_final_words(const uint16_t* words, size_t words_len, uint16_t* final_words, size_t max_final_words_len);
+
+#if !defined(ARDUINO) && !defined(__AVR__)
+
+// Generates a new random secret of `secret_len` bytes (16, 20, 24, 28 or 32)
+// from the operating system's CSPRNG and writes out
+// its BIP39 words or English mnemonics. Returns the number of words or the
+// length of the string written, or 0 on failure.
+size_t bip39_generate_words(size_t secret_len, uint16_t* words, size_t max_words_len);
+size_t bip39_generate_mnemonics(size_t secret_len, char* mnemonics, size_t max_mnemonics_len);
+
+// Generates `count` random phrases of `secret_len` bytes each, writing
+// their words back to back into `words`, which must hold
+// `count * secret_len * 3 / 4` words. Returns the number of phrases
+// generated, which is less than `count` only if the CSPRNG failed.
+size_t bip39_generate_words_batch(size_t secret_len, size_t count, uint16_t* words);
+
+#endif
+
 // Writes the 32-byte (BIP39_SEED_LEN) SHA256 hash of `string` to `seed`.
 #define BIP39_SEED_LEN 32
 void bip39_seed_from_string(const char* string, uint8_t* seed);
 
+// Computes the same seed over input supplied in pieces, so large inputs need
+// not be held in memory. `bip39_seed_stream_final` writes the seed for
+// everything passed to `bip39_seed_stream_update` since the stream was
+// created or last finalized, then resets the stream. `bip39_new_seed_stream`
+// returns NULL if the stream cannot be allocated.
+void* bip39_new_seed_stream();
+void bip39_dispose_seed_stream(void* stream);
+void bip39_seed_stream_update(void* stream, const uint8_t* bytes, size_t length);
+void bip39_seed_stream_final(void* stream, uint8_t* seed);
+
+#if !defined(ARDUINO) && !defined(__AVR__)
+
+// Computes the seed of everything read from `fd` until end of file. Returns
+// false, zeroing `seed`, if a read fails or the read buffer cannot be
+// allocated.
+bool bip39_seed_from_fd(int fd, uint8_t* seed);
+
+#endif
+
+// Writes the 64-byte (BIP39_MNEMONIC_SEED_LEN) BIP39 seed for the given
+// mnemonic sentence and passphrase (NULL for none), using 2048 rounds of
+// PBKDF2-HMAC-SHA512. The sentence is used exactly as given; it is not
+// checked against the word list. Callers accepting non-ASCII passphrases
+// must NFKD-normalize them first. Returns false, zeroing `seed`, if memory
+// for the salt cannot be allocated.
+#define BIP39_MNEMONIC_SEED_LEN 64
+#define BIP39_PBKDF2_ROUNDS 2048
+bool bip39_seed_from_mnemonics(const char* mnemonics, const char* passphrase, uint8_t* seed);
+
+
+// Derives the BIP32 master key for a phrase in one call: the phrase is
+// parsed and its checksum verified, then it is re-joined with single
+// spaces, stretched into its seed, and hashed with HMAC-SHA512 keyed with
+// "Bitcoin seed". Writes the 32-byte private key followed by the 32-byte
+// chain code to `master_key`. Returns false, and zeroes `master_key`, if the
+// phrase is not 12, 15, 18, 21 or 24 valid words or the key is not a valid
+// secp256k1 scalar. Uses no heap memory.
+#define BIP39_MASTER_KEY_LEN 64
+bool bip39_master_key_from_mnemonics(const char* mnemonics, size_t mnemonics_len, const char* passphrase, uint8_t* master_key);
+
+// Derives BIP85 child phrases from a master key in the form written by
+// `bip39_master_key_from_mnemonics`: the phrase for `index` (below 2^31)
+// at m/83696968'/39'/0'/{words_len}'/{index}'. `words_len` is 12, 18 or 24.
+// Returns the number of words or the length of the string written, or 0 on
+// failure. The batch form writes the phrases for `count` consecutive
+// indices back to back, deriving their shared parent once, and returns the
+// number derived.
+size_t bip39_bip85_words(const uint8_t* master_key, size_t words_len, uint32_t index, uint16_t* words);
+size_t bip39_bip85_mnemonics(const uint8_t* master_key, size_t words_len, uint32_t index, char* mnemonics, size_t max_mnemonics_len);
+size_t bip39_bip85_words_batch(const uint8_t* master_key, size_t words_len, uint32_t first_index, size_t count, uint16_t* words);
+
+#ifndef ARDUINO
+
+// Derives `count` master keys, spreading the phrases over up to `threads`
+// threads (including the caller). `passphrases` may be NULL for none.
+// `master_keys` holds `count * BIP39_MASTER_KEY_LEN` bytes, and `valid`, if
+// not NULL, receives each phrase's result. Returns the number of valid
+// phrases.
+size_t bip39_master_keys_from_mnemonics(const char* const* mnemonics, const char* const* passphrases, size_t count, size_t threads, uint8_t* master_keys, bool* valid);
+
+#endif
+
+// SeedQR payloads. The standard format is each word number as four decimal
+// digits (48 digits for 12 words); the compact format is the secret bytes,
+// checksum omitted. Only 12, 15, 18, 21 and 24-word phrases are accepted,
+// and phrases are checked against their checksum in both directions, so a
+// misread code is rejected. The string form writes a terminating NUL and
+// needs room for it. Returns the number of digits, bytes or words written,
+// or 0 if the input is invalid or does not fit.
+size_t bip39_seedqr_from_words(const uint16_t* words, size_t words_len, char* digits, size_t max_digits_len);
+size_t bip39_words_from_seedqr(const char* digits, size_t digits_len, uint16_t* words, size_t max_words_len);
+size_t bip39_compact_seedqr_from_words(const uint16_t* words, size_t words_len, uint8_t* bytes, size_t max_bytes_len);
+size_t bip39_words_from_compact_seedqr(const uint8_t* bytes, size_t bytes_len, uint16_t* words, size_t max_words_len);
+
+// Batch forms over `count` fixed-size records stored back to back: phrases
+// of `words_len` words, standard payloads of `words_len * 4` digits with no
+// terminators, and compact payloads of `words_len * 4 / 3` bytes. Invalid
+// records are written as zeros and flagged in `valid`, which may be NULL.
+// Returns the number of valid records.
+size_t bip39_seedqr_from_words_batch(const uint16_t* words, size_t words_len, size_t count, char* digits, bool* valid);
+size_t bip39_words_from_seedqr_batch(const char* digits, size_t words_len, size_t count, uint16_t* words, bool* valid);
+size_t bip39_compact_seedqr_from_words_batch(const uint16_t* words, size_t words_len, size_t count, uint8_t* bytes, bool* valid);
+size_t bip39_words_from_compact_seedqr_batch(const uint8_t* bytes, size_t bytes_len, size_t count, uint16_t* words);
 
 //
 // The following API is low-level and requires the creation of a context handle.
 //
 
+// Contexts come from a small pool of locked memory shared by the library.
+// When the pool is exhausted they fall back to the ordinary heap, which is
+// still wiped on release but may be swapped out. Returns NULL if memory
+// could not be allocated; the high-level calls above then fail as they do
+// for invalid input.
 void* bip39_new_context();
 void bip39_dispose_context(void* ctx);
 
@@ -56,6 +227,26 @@ const char* bip39_get_high(const void* ctx);
 const bool bip39_done_search(const void* ctx);
 const uint16_t bip39_selected_word(const void* ctx);
 
+// Picks a word by narrowing the list k ways per step, for k-button input.
+// Each branch is a contiguous run of words; `bip39_kway_branch_start` gives
+// the first word of a branch, so branch `b` covers the words from
+// `bip39_kway_branch_start(ctx, b)` up to (not including) the start of
+// `b + 1`. Branch `k` is the end of the current range. Choosing an empty or
+// out-of-range branch is ignored. Use `bip39_done_search` and
+// `bip39_selected_word` to finish.
+void bip39_start_kway_search(void* ctx, uint8_t k);
+uint16_t bip39_kway_branch_start(const void* ctx, uint8_t branch);
+void bip39_choose_kway(void* ctx, uint8_t branch);
+
+// Picks a word by phone-keypad digits ('2' = abc ... '9' = wxyz), one digit
+// per letter. The candidates are the words whose first letters spell the
+// digits entered so far. `bip39_keypad_press` returns false, and leaves the
+// candidates unchanged, if no word matches the extended sequence.
+void bip39_start_keypad_search(void* ctx);
+bool bip39_keypad_press(void* ctx, char key);
+size_t bip39_keypad_candidate_count(const void* ctx);
+uint16_t bip39_keypad_candidate(const void* ctx, size_t n);
+
 void bip39_set_byte_count(void* ctx, size_t bytes);
 void bip39_set_bytes(void* ctx, const uint8_t* bytes, size_t length);
 const uint8_t* bip39_get_bytes(const void* ctx);
@@ -72,4 +263,263 @@ bool bip39_verify_checksum(const void* ctx);
 
 void bip39_clear(void* ctx);
 
+
+//
+// The following API reports on the codec kernels chosen for this CPU.
+//
+
+// Returns the name of the kernel variant in use: "scalar", "bmi2" or
+// "avx2". The variant also provides the constant-time word lookup.
+// Setting the environment variable BIP39_FORCE_BASELINE=1 before first use
+// forces "scalar".
+const char* bip39_kernel_name(void);
+
+// Cross-checks every variant this CPU supports against the scalar reference
+// on `rounds` pseudo-random secrets of each size, plus edge cases, and its
+// word lookup on a pseudo-random table. Returns true if all agree.
+bool bip39_kernel_self_test(size_t rounds);
+
+
+#ifndef ARDUINO
+
+//
+// The following API derives seeds on a pool of worker threads, so that
+// event-loop servers never block on PBKDF2.
+//
+
+#define BIP39_SEED_OK 0
+#define BIP39_SEED_CANCELLED 1
+#define BIP39_SEED_FAILED 2
+
+// Called from `bip39_poll_seeds` on the polling thread. `seed` is NULL
+// unless `status` is BIP39_SEED_OK, and is wiped after the callback returns.
+typedef void (*bip39_seed_callback)(uint64_t job_id, int status, const uint8_t* seed, void* user_data);
+
+// Starts `threads` workers. At most `max_jobs` jobs may be outstanding
+// (submitted but not yet delivered by `bip39_poll_seeds`). Disposing the
+// queue cancels outstanding jobs without calling their callbacks. Returns
+// NULL if the queue cannot be allocated or no worker can be started.
+void* bip39_new_seed_queue(size_t threads, size_t max_jobs);
+void bip39_dispose_seed_queue(void* queue);
+
+// Queues a derivation; the strings are copied. Returns the job ID, or 0 if
+// `max_jobs` jobs are already outstanding or the job cannot be allocated.
+uint64_t bip39_submit_seed(void* queue, const char* mnemonics, const char* passphrase, bip39_seed_callback callback, void* user_data);
+
+// Cancels a job. A job that has not started is never derived. A running job
+// finishes, but its seed is discarded. Either way its callback is called
+// with BIP39_SEED_CANCELLED. A job whose derivation runs out of memory is
+// delivered with BIP39_SEED_FAILED. Returns false if the job is unknown or has
+// already completed.
+bool bip39_cancel_seed(void* queue, uint64_t job_id);
+
+// Returns a file descriptor that becomes readable when completions are
+// waiting, for use with poll/epoll/kqueue.
+int bip39_seed_queue_fd(const void* queue);
+
+// Delivers up to `max_completions` finished jobs to their callbacks on the
+// calling thread without blocking. Returns the number delivered.
+size_t bip39_poll_seeds(void* queue, size_t max_completions);
+
+#endif
+
+#ifndef ARDUINO
+
+//
+// The following API caches derived seeds, for services that derive the
+// seed for the same phrase and passphrase repeatedly.
+//
+
+// Creates a cache holding at most `max_entries` seeds, each kept for
+// `ttl_seconds` after it was derived (0 for no expiry). The least recently
+// used seed is evicted first. Entries are keyed by a keyed hash of the
+// phrase and passphrase and hold the seed encrypted under a random
+// per-cache key; evicted entries are wiped, and so are expired ones on the
+// next call into the cache. Safe to share between threads. Returns NULL if
+// `max_entries` is 0 or too large, or if memory could not be allocated.
+void* bip39_new_seed_cache(size_t max_entries, uint32_t ttl_seconds);
+void bip39_dispose_seed_cache(void* cache);
+
+// Removes and wipes every entry.
+void bip39_clear_seed_cache(void* cache);
+
+// Same as `bip39_seed_from_mnemonics`, but returns a cached seed when there
+// is one. Returns true on a hit, false if the seed was derived. A seed that
+// could not be derived is zeroed and not cached.
+bool bip39_cached_seed_from_mnemonics(void* cache, const char* mnemonics, const char* passphrase, uint8_t* seed);
+
+// Reports hit and miss counts and the number of live entries. Any pointer
+// may be NULL.
+void bip39_seed_cache_stats(void* cache, uint64_t* hits, uint64_t* misses, size_t* entries);
+
+#endif
+
+#ifndef ARDUINO
+
+//
+// The following API loads other word lists from binary images that are used
+// in place, so a list can be memory-mapped and shared between processes.
+//
+
+// Writes a wordlist image for the given 2048 words (NULL for the built-in
+// English list). Returns the image length, or 0 if the words are invalid
+// (empty or duplicated) or memory could not be allocated. If `image` is NULL or `max_image_len` is too small,
+// nothing is written and the required length is returned.
+size_t bip39_wordlist_write_image(const char* const* words, uint8_t* image, size_t max_image_len);
+
+// Opens a wordlist image after checking its header and section bounds.
+// `bip39_wordlist_from_image` uses caller-owned memory, which must outlive
+// the handle; `bip39_wordlist_open` maps a file read-only. Both return NULL
+// for an invalid image.
+void* bip39_wordlist_from_image(const void* image, size_t image_len);
+void* bip39_wordlist_open(const char* path);
+void bip39_wordlist_close(void* wordlist);
+
+// Returns the word's string inside the image, or NULL if out of range.
+const char* bip39_wordlist_get_mnemonic(const void* wordlist, uint16_t word);
+
+// Returns the word number of `mnemonic`, or -1 if it is not in the list.
+int16_t bip39_wordlist_word_from_mnemonic(const void* wordlist, const char* mnemonic);
+int16_t bip39_wordlist_word_from_mnemonic_len(const void* wordlist, const char* mnemonic, size_t mnemonic_len);
+
+// Works out which of `wordlists` (NULL entries stand for the built-in
+// English list) a phrase of up to 24 words is written in. Words are
+// separated by ASCII whitespace or U+3000. Returns the number of lists that
+// contain every word and, for 12 to 24-word phrases, give a valid checksum;
+// 0 means no list fits. Phrases of fewer than 12 words fit any list that
+// contains every word; other lengths without a checksum, such as 13 words,
+// fit none. `ranking`, if not NULL, receives all
+// `wordlists_len` list positions, best first: lists that fit, then lists
+// that contain every word but fail the checksum, then the rest by how many
+// leading words they contain before the first missing one (later words are
+// not looked up, so nothing-fits is rejected quickly). When some list fits, `words` (room for 24, may be
+// NULL) receives the phrase's words in the best list, and `words_len` their
+// number; otherwise `words_len` is set to 0.
+#define BIP39_DETECT_MAX_WORDLISTS 32
+size_t bip39_detect_wordlist(const void* const* wordlists, size_t wordlists_len, const char* mnemonics, size_t mnemonics_len, size_t* ranking, uint16_t* words, size_t* words_len);
+
+#endif
+
+//
+// The following API scans arbitrary bytes, such as logs, for leaked phrases.
+//
+
+// Called for each phrase of 12, 15, 18, 21 or 24 consecutive words with a
+// valid checksum. `offset` and `length` give the bytes from the start of the
+// first word to the end of the last, counted from the start of the stream.
+typedef void (*bip39_scan_callback)(size_t offset, size_t length, const uint16_t* words, size_t words_len, void* user_data);
+
+// A scanner holds only its own state, so separate streams can be scanned
+// on separate threads with one scanner each. Returns NULL if the scanner
+// cannot be allocated.
+void* bip39_new_scanner(bip39_scan_callback callback, void* user_data);
+void bip39_dispose_scanner(void* scanner);
+
+// Feeds the next chunk of the stream. Words may span chunks.
+void bip39_scan(void* scanner, const uint8_t* bytes, size_t length);
+
+// Reports any phrase still pending at the end of the stream and resets the
+// scanner for a new stream.
+void bip39_finish_scan(void* scanner);
+
+#if !defined(ARDUINO) && !defined(__AVR__)
+
+// Called for each phrase found in `paths[path]`; offsets count from the
+// start of that file. Calls are serialized, but come from any of the
+// scanning threads.
+typedef void (*bip39_scan_file_callback)(size_t path, size_t offset, size_t length, const uint16_t* words, size_t words_len, void* user_data);
+
+// Scans whole files on up to `threads` threads (including the caller), one
+// scanner per thread and one file per scanner at a time. Returns the number
+// of files that could not be read to the end.
+size_t bip39_scan_files(const char* const* paths, size_t paths_len, size_t threads, bip39_scan_file_callback callback, void* user_data);
+
+#endif
+
+#ifndef ARDUINO
+
+//
+// The following API finds phrases that share a secret across datasets too
+// large to compare pairwise, such as wallet backups collected over years.
+//
+
+// Called with the ids of the phrases that decode to one secret. For
+// duplicates only `ids_a` is used; for shared secrets `ids_a` and `ids_b`
+// hold the matching ids from each set.
+typedef void (*bip39_group_callback)(const uint64_t* ids_a, size_t ids_a_len, const uint64_t* ids_b, size_t ids_b_len, void* user_data);
+
+// Creates a set that holds about `memory_budget` bytes of records in memory
+// and spills sorted runs to unlinked temporary files in `spill_dir` (NULL
+// for $TMPDIR or /tmp) beyond that. Runs are sorted on `threads` threads.
+// Records hold a keyed hash of the secret, never the secret itself, under a
+// random per-process key, so sets can only be compared within one process.
+// Returns NULL if no random key could be made or memory could not be
+// allocated.
+void* bip39_new_entropy_set(size_t memory_budget, size_t threads, const char* spill_dir);
+void bip39_dispose_entropy_set(void* set);
+
+// Decodes a phrase of 12 to 24 words, ignoring case and the characters
+// between words, and records its secret under `id`. Returns false if the
+// phrase is invalid or a run could not be spilled; after a spill failure
+// the set reports nothing.
+bool bip39_entropy_set_add(void* set, const char* mnemonics, size_t mnemonics_len, uint64_t id);
+
+// False once a run could not be spilled, or once a query ran out of memory
+// and stopped early; check it after querying as well as after adding.
+bool bip39_entropy_set_ok(void* set);
+
+// Reports each secret recorded more than once. Returns the number of
+// groups reported. A set can be queried repeatedly and added to between
+// queries.
+size_t bip39_find_duplicates(void* set, bip39_group_callback callback, void* user_data);
+
+// Reports each secret recorded in both sets. Returns the number reported.
+size_t bip39_find_shared(void* set_a, void* set_b, bip39_group_callback callback, void* user_data);
+
+#endif
+
+#ifndef ARDUINO
+
+//
+// The following API recovers the order of a phrase whose words are all
+// known but whose order is not, such as a backup card read the wrong way.
+//
+
+// Marks a position whose word is unknown in the `fixed` arrays below.
+#define BIP39_ORDER_ANY 0xFFFF
+
+// Returned by `bip39_recover_order` when memory could not be allocated;
+// nothing was searched.
+#define BIP39_ORDER_FAILED UINT64_MAX
+
+// Called for each order with a valid checksum, one call at a time. A 12
+// word phrase passes one order in 16 by chance, so the callback should
+// confirm candidates against something else, such as the fingerprint of
+// the wallet's master key. Returns true to stop the search.
+typedef bool (*bip39_order_callback)(const uint16_t* words, size_t words_len, void* user_data);
+
+// Called as the search advances: the units before `resume_unit` have all
+// been searched. Returns false to stop the search.
+typedef bool (*bip39_order_progress)(uint64_t resume_unit, uint64_t units_len, void* user_data);
+
+// Returns the number of units the search for these words is divided into,
+// or 0 if the words cannot form a 12, 15, 18, 21 or 24 word phrase with
+// the `fixed` words (NULL for none) at their positions.
+uint64_t bip39_order_units(const uint16_t* words, size_t words_len, const uint16_t* fixed);
+
+// Tries every order of `words` that keeps each `fixed[i]` (NULL for none)
+// other than BIP39_ORDER_ANY at position i, on up to `threads` threads
+// (including the caller). Units before `first_unit` are skipped, so a
+// stopped search resumes by passing the value returned. Returns the unit
+// to resume from, which is `bip39_order_units` when the search completed,
+// or BIP39_ORDER_FAILED if memory could not be allocated.
+uint64_t bip39_recover_order(const uint16_t* words, size_t words_len, const uint16_t* fixed, size_t threads, uint64_t first_unit, bip39_order_callback found, bip39_order_progress progress, void* user_data);
+
+// Tries only the orders of reading `words`, written out row by row on a
+// grid of any shape, by columns, from any corner, or alternating direction
+// each row or column. Returns the number of orders passed to `found`.
+size_t bip39_recover_layout(const uint16_t* words, size_t words_len, const uint16_t* fixed, bip39_order_callback found, void* user_data);
+
+#endif
+
 #endif
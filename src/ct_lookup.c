@@ -0,0 +1,54 @@
+#include "bip39.h"
+#include "kernels.h"
+
+#if !defined(ARDUINO) && !defined(__AVR__)
+
+#include <pthread.h>
+#include <string.h>
+
+#include <bc-crypto-base/bc-crypto-base.h>
+
+// Constant-time word lookup. Every word is stored NUL-padded in an 8-byte
+// slot, and the padded input is compared against all 2048 slots. Matches
+// are folded into the result with masks, so neither branches nor memory
+// accesses depend on the input's contents, only on its length. The search
+// itself comes from the kernel variant selected for this CPU.
+
+#define SLOT_LEN 8
+
+static uint64_t slots[BIP39_SLOTS_LEN];
+static bip39_slot_search find_slot;
+
+static pthread_once_t init_once = PTHREAD_ONCE_INIT;
+
+static void init_lookup() {
+    for (uint16_t i = 0; i < BIP39_SLOTS_LEN; i++) {
+        char mnemonic[SLOT_LEN + 1] = { 0 };
+        bip39_mnemonic_from_word(i, mnemonic);
+        memcpy(&slots[i], mnemonic, SLOT_LEN);
+    }
+    find_slot = bip39_selected_variant()->find_slot;
+}
+
+int16_t bip39_word_from_mnemonic_constant_time(const char* mnemonic, size_t mnemonic_len) {
+    if (mnemonic == NULL || mnemonic_len > SLOT_LEN) {
+        return -1;
+    }
+    pthread_once(&init_once, init_lookup);
+
+    // An embedded NUL would otherwise match the padding of a shorter word.
+    uint8_t padded[SLOT_LEN] = { 0 };
+    uint8_t has_nul = 0;
+    for (size_t i = 0; i < mnemonic_len; i++) {
+        padded[i] = mnemonic[i];
+        has_nul |= (uint8_t)((((uint16_t)padded[i]) - 1) >> 8);
+    }
+    uint64_t key;
+    memcpy(&key, padded, SLOT_LEN);
+    int16_t w = find_slot(slots, key);
+    memzero(padded, sizeof(padded));
+    memzero(&key, sizeof(key));
+    return w | -(int16_t)(has_nul & 1);
+}
+
+#endif
@@ -0,0 +1,475 @@
+#ifndef ARDUINO
+
+#include "bip39.h"
+#include "arena.h"
+#include "entropy.h"
+#include "kernels.h"
+#include "lookup.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <bc-crypto-base/bc-crypto-base.h>
+
+// Finds phrases that decode to the same secret across large datasets.
+// Each phrase is decoded, and its secret is reduced to a 32-byte
+// HMAC-SHA256 key under a random per-process key, so the fixed-width
+// records that get sorted (and spilled to disk when the memory budget runs
+// out) never contain a secret, and sets built in one process can be joined.
+// A full buffer is sorted as a run: one parallel counting pass on the first
+// key byte, a parallel scatter, then the buckets sorted in parallel. Runs
+// are merged while the duplicates or the intersection are reported.
+
+#define KEY_LEN SHA256_DIGEST_LENGTH
+#define RADIX_BUCKETS 256
+#define MAX_THREADS 64
+#define MAX_PHRASE_WORDS 24
+#define MAX_WORD_LEN 8
+#define MIN_RUN_RECORDS 64
+#define IDS_CHUNK 64
+
+typedef struct record_t {
+    uint8_t key[KEY_LEN];
+    uint64_t id;
+} record;
+
+typedef struct entropy_set_t {
+    record* records;
+    record* scratch;
+    size_t records_len;
+    size_t records_cap;
+    size_t threads;
+
+    char* spill_dir;
+    FILE** runs;
+    size_t runs_len;
+    bool failed;
+} entropy_set;
+
+static uint8_t* process_key;
+static pthread_once_t process_key_once = PTHREAD_ONCE_INIT;
+
+static void init_process_key() {
+    process_key = bip39_secure_alloc(KEY_LEN);
+    if (process_key != NULL && !bip39_random_bytes(process_key, KEY_LEN)) {
+        bip39_secure_free(process_key, KEY_LEN);
+        process_key = NULL;
+    }
+}
+
+void* bip39_new_entropy_set(size_t memory_budget, size_t threads, const char* spill_dir) {
+    pthread_once(&process_key_once, init_process_key);
+    if (process_key == NULL) {
+        return NULL;
+    }
+    entropy_set* s = calloc(sizeof(entropy_set), 1);
+    if (s == NULL) {
+        return NULL;
+    }
+    // Records and the scatter buffer share the budget.
+    s->records_cap = memory_budget / (2 * sizeof(record));
+    if (s->records_cap < MIN_RUN_RECORDS) {
+        s->records_cap = MIN_RUN_RECORDS;
+    }
+    s->records = malloc(s->records_cap * sizeof(record));
+    s->scratch = malloc(s->records_cap * sizeof(record));
+    s->threads = threads == 0 ? 1 : threads > MAX_THREADS ? MAX_THREADS : threads;
+    if (spill_dir == NULL) {
+        spill_dir = getenv("TMPDIR");
+    }
+    s->spill_dir = strdup(spill_dir == NULL ? "/tmp" : spill_dir);
+    if (s->records == NULL || s->scratch == NULL || s->spill_dir == NULL) {
+        bip39_dispose_entropy_set(s);
+        return NULL;
+    }
+    return s;
+}
+
+void bip39_dispose_entropy_set(void* set) {
+    entropy_set* s = set;
+    for (size_t i = 0; i < s->runs_len; i++) {
+        fclose(s->runs[i]);
+    }
+    free(s->runs);
+    free(s->records);
+    free(s->scratch);
+    free(s->spill_dir);
+    free(s);
+}
+
+// Phrases are matched regardless of case and of the whitespace or
+// punctuation between words.
+static size_t words_from_phrase(const char* phrase, size_t phrase_len, uint16_t* words) {
+    size_t words_len = 0;
+    size_t i = 0;
+    while (i < phrase_len) {
+        char word[MAX_WORD_LEN + 1];
+        size_t word_len = 0;
+        bool letters = false;
+        while (i < phrase_len) {
+            char c = phrase[i];
+            if (c >= 'A' && c <= 'Z') {
+                c += 'a' - 'A';
+            }
+            if (c < 'a' || c > 'z') {
+                break;
+            }
+            if (word_len < sizeof(word)) {
+                word[word_len] = c;
+            }
+            word_len++;
+            letters = true;
+            i++;
+        }
+        if (letters) {
+            // Phrases here are bulk data rather than one secret being
+            // checked, so the table lookup's speed matters more than its
+            // word-dependent timing.
+            int16_t w = -1;
+            if (words_len < MAX_PHRASE_WORDS && word_len <= MAX_WORD_LEN) {
+                w = bip39_table_word_from_mnemonic_len(word, word_len);
+            }
+            memzero(word, sizeof(word));
+            if (w < 0) {
+                return 0;
+            }
+            words[words_len++] = w;
+        } else {
+            i++;
+        }
+    }
+    return words_len;
+}
+
+// Sorting.
+
+typedef struct sort_job_t {
+    record* in;
+    record* out;
+    size_t begin;
+    size_t end;
+    size_t counts[RADIX_BUCKETS];
+    size_t* offsets;
+    size_t first_bucket;
+    size_t last_bucket;
+    const size_t* bucket_starts;
+} sort_job;
+
+static int compare_records(const void* a, const void* b) {
+    return memcmp(((const record*)a)->key, ((const record*)b)->key, KEY_LEN);
+}
+
+static void* count_job(void* arg) {
+    sort_job* j = arg;
+    memset(j->counts, 0, sizeof(j->counts));
+    for (size_t i = j->begin; i < j->end; i++) {
+        j->counts[j->in[i].key[0]]++;
+    }
+    return NULL;
+}
+
+static void* scatter_job(void* arg) {
+    sort_job* j = arg;
+    for (size_t i = j->begin; i < j->end; i++) {
+        j->out[j->offsets[j->in[i].key[0]]++] = j->in[i];
+    }
+    return NULL;
+}
+
+static void* bucket_job(void* arg) {
+    sort_job* j = arg;
+    for (size_t b = j->first_bucket; b < j->last_bucket; b++) {
+        size_t start = j->bucket_starts[b];
+        size_t len = j->bucket_starts[b + 1] - start;
+        qsort(j->out + start, len, sizeof(record), compare_records);
+    }
+    return NULL;
+}
+
+static void run_jobs(sort_job* jobs, size_t threads, void* (*fn)(void*)) {
+    pthread_t ids[MAX_THREADS];
+    bool started[MAX_THREADS];
+    for (size_t t = 1; t < threads; t++) {
+        started[t] = pthread_create(&ids[t], NULL, fn, &jobs[t]) == 0;
+    }
+    fn(&jobs[0]);
+    for (size_t t = 1; t < threads; t++) {
+        if (started[t]) {
+            pthread_join(ids[t], NULL);
+        } else {
+            fn(&jobs[t]);
+        }
+    }
+}
+
+// Sorts s->records into s->scratch, then swaps the two.
+static void sort_records(entropy_set* s) {
+    size_t n = s->records_len;
+    size_t threads = s->threads;
+    if (threads > n / MIN_RUN_RECORDS + 1) {
+        threads = n / MIN_RUN_RECORDS + 1;
+    }
+    sort_job jobs[MAX_THREADS];
+    size_t offsets[MAX_THREADS][RADIX_BUCKETS];
+    size_t bucket_starts[RADIX_BUCKETS + 1];
+
+    for (size_t t = 0; t < threads; t++) {
+        jobs[t].in = s->records;
+        jobs[t].out = s->scratch;
+        jobs[t].begin = n * t / threads;
+        jobs[t].end = n * (t + 1) / threads;
+        jobs[t].offsets = offsets[t];
+        jobs[t].bucket_starts = bucket_starts;
+    }
+    run_jobs(jobs, threads, count_job);
+
+    size_t pos = 0;
+    for (size_t b = 0; b < RADIX_BUCKETS; b++) {
+        bucket_starts[b] = pos;
+        for (size_t t = 0; t < threads; t++) {
+            offsets[t][b] = pos;
+            pos += jobs[t].counts[b];
+        }
+    }
+    bucket_starts[RADIX_BUCKETS] = pos;
+    run_jobs(jobs, threads, scatter_job);
+
+    for (size_t t = 0; t < threads; t++) {
+        jobs[t].first_bucket = RADIX_BUCKETS * t / threads;
+        jobs[t].last_bucket = RADIX_BUCKETS * (t + 1) / threads;
+    }
+    run_jobs(jobs, threads, bucket_job);
+
+    record* sorted = s->scratch;
+    s->scratch = s->records;
+    s->records = sorted;
+}
+
+static bool spill(entropy_set* s) {
+    sort_records(s);
+    size_t path_len = strlen(s->spill_dir) + 32;
+    char path[path_len];
+    snprintf(path, path_len, "%s/bc-bip39-run-XXXXXX", s->spill_dir);
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        return false;
+    }
+    unlink(path);
+    FILE* f = fdopen(fd, "w+b");
+    if (f == NULL) {
+        close(fd);
+        return false;
+    }
+    if (fwrite(s->records, sizeof(record), s->records_len, f) != s->records_len || fflush(f) != 0) {
+        fclose(f);
+        return false;
+    }
+    FILE** runs = realloc(s->runs, (s->runs_len + 1) * sizeof(FILE*));
+    if (runs == NULL) {
+        fclose(f);
+        return false;
+    }
+    s->runs = runs;
+    s->runs[s->runs_len++] = f;
+    s->records_len = 0;
+    return true;
+}
+
+bool bip39_entropy_set_add(void* set, const char* mnemonics, size_t mnemonics_len, uint64_t id) {
+    entropy_set* s = set;
+    uint16_t words[MAX_PHRASE_WORDS];
+    uint8_t secret[32];
+    size_t words_len = words_from_phrase(mnemonics, mnemonics_len, words);
+    const bip39_kernel* kernel = bip39_kernel_for_words_len(words_len);
+    bool valid = kernel != NULL && kernel->decode(words, secret);
+    memzero(words, sizeof(words));
+    if (!valid) {
+        memzero(secret, sizeof(secret));
+        return false;
+    }
+    if (s->records_len == s->records_cap && !spill(s)) {
+        s->failed = true;
+        memzero(secret, sizeof(secret));
+        return false;
+    }
+    record* r = &s->records[s->records_len++];
+    hmac_sha256(process_key, KEY_LEN, secret, kernel->secret_len, r->key);
+    r->id = id;
+    memzero(secret, sizeof(secret));
+    return true;
+}
+
+bool bip39_entropy_set_ok(void* set) {
+    return !((entropy_set*)set)->failed;
+}
+
+// Merging.
+
+typedef struct cursor_t {
+    entropy_set* set;
+    size_t memory_next;
+    record* heads;
+    bool* live;
+    size_t sources;
+} cursor;
+
+static bool read_run(FILE* f, record* r) {
+    return fread(r, sizeof(record), 1, f) == 1;
+}
+
+// Sources are the spilled runs followed by the in-memory run.
+static bool advance_source(cursor* c, size_t i) {
+    entropy_set* s = c->set;
+    if (i < s->runs_len) {
+        c->live[i] = read_run(s->runs[i], &c->heads[i]);
+    } else {
+        c->live[i] = c->memory_next < s->records_len;
+        if (c->live[i]) {
+            c->heads[i] = s->records[c->memory_next++];
+        }
+    }
+    return c->live[i];
+}
+
+static void close_cursor(cursor* c);
+
+static bool open_cursor(entropy_set* s, cursor* c) {
+    if (s->failed) {
+        return false;
+    }
+    sort_records(s);
+    c->set = s;
+    c->memory_next = 0;
+    c->sources = s->runs_len + 1;
+    c->heads = malloc(c->sources * sizeof(record));
+    c->live = malloc(c->sources * sizeof(bool));
+    if (c->heads == NULL || c->live == NULL) {
+        close_cursor(c);
+        s->failed = true;
+        return false;
+    }
+    for (size_t i = 0; i < c->sources; i++) {
+        if (i < s->runs_len) {
+            rewind(s->runs[i]);
+        }
+        advance_source(c, i);
+    }
+    return true;
+}
+
+static void close_cursor(cursor* c) {
+    free(c->heads);
+    free(c->live);
+}
+
+// The smallest head across the sources, or NULL once all are exhausted.
+static const record* peek(cursor* c, size_t* source) {
+    const record* best = NULL;
+    for (size_t i = 0; i < c->sources; i++) {
+        if (c->live[i] && (best == NULL || compare_records(&c->heads[i], best) < 0)) {
+            best = &c->heads[i];
+            *source = i;
+        }
+    }
+    return best;
+}
+
+typedef struct id_list_t {
+    uint64_t* ids;
+    size_t len;
+    size_t cap;
+} id_list;
+
+static bool push_id(id_list* l, uint64_t id) {
+    if (l->len == l->cap) {
+        size_t cap = l->cap == 0 ? IDS_CHUNK : l->cap * 2;
+        uint64_t* ids = realloc(l->ids, cap * sizeof(uint64_t));
+        if (ids == NULL) {
+            return false;
+        }
+        l->ids = ids;
+        l->cap = cap;
+    }
+    l->ids[l->len++] = id;
+    return true;
+}
+
+// Collects the ids of every record with the next key into `ids`, copying
+// the key to `key`. Returns false when the cursor is exhausted, or marks
+// the set failed and returns false if the ids could not be held.
+static bool next_group(cursor* c, uint8_t* key, id_list* ids) {
+    size_t source;
+    const record* r = peek(c, &source);
+    ids->len = 0;
+    if (r == NULL) {
+        return false;
+    }
+    memcpy(key, r->key, KEY_LEN);
+    do {
+        if (!push_id(ids, r->id)) {
+            c->set->failed = true;
+            return false;
+        }
+        advance_source(c, source);
+        r = peek(c, &source);
+    } while (r != NULL && memcmp(r->key, key, KEY_LEN) == 0);
+    return true;
+}
+
+size_t bip39_find_duplicates(void* set, bip39_group_callback callback, void* user_data) {
+    entropy_set* s = set;
+    cursor c;
+    if (!open_cursor(s, &c)) {
+        return 0;
+    }
+    uint8_t key[KEY_LEN];
+    id_list ids = { 0 };
+    size_t groups = 0;
+    while (next_group(&c, key, &ids)) {
+        if (ids.len > 1) {
+            callback(ids.ids, ids.len, NULL, 0, user_data);
+            groups++;
+        }
+    }
+    free(ids.ids);
+    close_cursor(&c);
+    return groups;
+}
+
+size_t bip39_find_shared(void* set_a, void* set_b, bip39_group_callback callback, void* user_data) {
+    cursor a, b;
+    if (!open_cursor(set_a, &a)) {
+        return 0;
+    }
+    if (!open_cursor(set_b, &b)) {
+        close_cursor(&a);
+        return 0;
+    }
+    uint8_t key_a[KEY_LEN], key_b[KEY_LEN];
+    id_list ids_a = { 0 }, ids_b = { 0 };
+    size_t groups = 0;
+    bool more_a = next_group(&a, key_a, &ids_a);
+    bool more_b = next_group(&b, key_b, &ids_b);
+    while (more_a && more_b) {
+        int order = memcmp(key_a, key_b, KEY_LEN);
+        if (order == 0) {
+            callback(ids_a.ids, ids_a.len, ids_b.ids, ids_b.len, user_data);
+            groups++;
+        }
+        if (order <= 0) {
+            more_a = next_group(&a, key_a, &ids_a);
+        }
+        if (order >= 0) {
+            more_b = next_group(&b, key_b, &ids_b);
+        }
+    }
+    free(ids_a.ids);
+    free(ids_b.ids);
+    close_cursor(&a);
+    close_cursor(&b);
+    return groups;
+}
+
+#endif /* ARDUINO */
@@ -0,0 +1,141 @@
+#ifndef ARDUINO
+
+#include "bip39.h"
+#include "kernels.h"
+
+#include <string.h>
+
+#include <bc-crypto-base/bc-crypto-base.h>
+
+// Tokenizes a phrase once, then looks each token up in every candidate list
+// that has matched all tokens so far. Each lookup is a single perfect-hash
+// probe, and a list drops out at its first miss, so a phrase that fits
+// nothing is usually rejected after the first token or two. Lists that match
+// every token are ranked by whether the checksum verifies (for standard
+// phrase lengths). Since a list is not probed again after its first miss,
+// the rest are ranked by how many leading tokens they matched before it.
+
+#define MAX_TOKENS 24
+
+typedef struct span_t {
+    const char* p;
+    size_t len;
+} span;
+
+// Words are separated by ASCII whitespace and the ideographic space U+3000
+// used in Japanese phrases.
+static size_t separator_len(const char* p, const char* end) {
+    uint8_t c = (uint8_t)p[0];
+    if (c <= ' ') {
+        return 1;
+    }
+    if (c == 0xE3 && end - p >= 3 && (uint8_t)p[1] == 0x80 && (uint8_t)p[2] == 0x80) {
+        return 3;
+    }
+    return 0;
+}
+
+static size_t tokenize(const char* mnemonics, size_t mnemonics_len, span* tokens) {
+    const char* p = mnemonics;
+    const char* end = mnemonics + mnemonics_len;
+    size_t tokens_len = 0;
+    while (p < end) {
+        size_t sep = separator_len(p, end);
+        if (sep > 0) {
+            p += sep;
+            continue;
+        }
+        if (tokens_len == MAX_TOKENS) {
+            return MAX_TOKENS + 1;
+        }
+        const char* start = p;
+        while (p < end && separator_len(p, end) == 0) {
+            p++;
+        }
+        tokens[tokens_len].p = start;
+        tokens[tokens_len].len = p - start;
+        tokens_len++;
+    }
+    return tokens_len;
+}
+
+static int16_t lookup(const void* wordlist, const span* token) {
+    if (wordlist == NULL) {
+        return bip39_word_from_mnemonic_len(token->p, token->len);
+    }
+    return bip39_wordlist_word_from_mnemonic_len(wordlist, token->p, token->len);
+}
+
+size_t bip39_detect_wordlist(const void* const* wordlists, size_t wordlists_len, const char* mnemonics, size_t mnemonics_len, size_t* ranking, uint16_t* words, size_t* words_len) {
+    if (words_len != NULL) {
+        *words_len = 0;
+    }
+    if (wordlists_len > BIP39_DETECT_MAX_WORDLISTS) {
+        return 0;
+    }
+
+    span tokens[MAX_TOKENS];
+    uint16_t found[BIP39_DETECT_MAX_WORDLISTS][MAX_TOKENS];
+    size_t score[BIP39_DETECT_MAX_WORDLISTS];
+    size_t tokens_len = tokenize(mnemonics, mnemonics_len, tokens);
+    uint32_t alive = tokens_len == 0 || tokens_len > MAX_TOKENS ? 0 : (uint32_t)((1ULL << wordlists_len) - 1);
+
+    memset(score, 0, sizeof(score));
+    for (size_t t = 0; t < tokens_len && alive != 0; t++) {
+        for (size_t l = 0; l < wordlists_len; l++) {
+            if (alive & (1UL << l)) {
+                int16_t w = lookup(wordlists[l], &tokens[t]);
+                if (w < 0) {
+                    alive &= ~(1UL << l);
+                } else {
+                    found[l][t] = w;
+                    score[l] += 2;
+                }
+            }
+        }
+    }
+
+    // A full match gets one more point if its checksum verifies, or if the
+    // phrase is too short to carry one. Other lengths with no checksum
+    // layout (13 words, say) are never consistent.
+    const bip39_kernel* kernel = bip39_kernel_for_words_len(tokens_len);
+    bool too_short = tokens_len < 12;
+    size_t consistent = 0;
+    for (size_t l = 0; l < wordlists_len; l++) {
+        if (alive & (1UL << l)) {
+            uint8_t secret[32];
+            if (kernel != NULL ? kernel->decode(found[l], secret) : too_short) {
+                score[l]++;
+                consistent++;
+            }
+            memzero(secret, sizeof(secret));
+        }
+    }
+
+    size_t order[BIP39_DETECT_MAX_WORDLISTS];
+    for (size_t l = 0; l < wordlists_len; l++) {
+        size_t i = l;
+        while (i > 0 && score[order[i - 1]] < score[l]) {
+            order[i] = order[i - 1];
+            i--;
+        }
+        order[i] = l;
+    }
+    if (ranking != NULL) {
+        memcpy(ranking, order, wordlists_len * sizeof(size_t));
+    }
+    if (consistent > 0) {
+        if (words != NULL) {
+            memcpy(words, found[order[0]], tokens_len * sizeof(uint16_t));
+        }
+        if (words_len != NULL) {
+            *words_len = tokens_len;
+        }
+    }
+
+    memzero(found, sizeof(found));
+    memzero(tokens, sizeof(tokens));
+    return consistent;
+}
+
+#endif /* ARDUINO */
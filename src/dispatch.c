@@ -0,0 +1,164 @@
+#include "bip39.h"
+#include "kernels.h"
+
+#include <string.h>
+
+#ifdef ARDUINO
+#include "bc-crypto-base.h"
+#else
+#include <bc-crypto-base/bc-crypto-base.h>
+#endif
+
+#if !defined(ARDUINO) && !defined(__AVR__)
+#include <pthread.h>
+#endif
+
+// Chooses a kernel variant once per process. The most capable variant the
+// CPU supports wins, unless the BIP39_FORCE_BASELINE environment variable is
+// set to anything but "0", which pins the scalar reference.
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(ARDUINO)
+extern const bip39_kernel_variant bip39_bmi2_variant;
+extern const bip39_kernel_variant bip39_avx2_variant;
+#define HAVE_X86_VARIANTS
+#endif
+
+static const bip39_kernel_variant* const all_variants[] = {
+    &bip39_scalar_variant,
+#ifdef HAVE_X86_VARIANTS
+    &bip39_bmi2_variant,
+    &bip39_avx2_variant,
+#endif
+};
+
+#define VARIANTS_LEN (sizeof(all_variants) / sizeof(all_variants[0]))
+
+static const bip39_kernel_variant* selected = &bip39_scalar_variant;
+
+static void select_variant() {
+#if !defined(ARDUINO) && !defined(__AVR__)
+    const char* force = getenv("BIP39_FORCE_BASELINE");
+    if (force != NULL && force[0] != '\0' && strcmp(force, "0") != 0) {
+        return;
+    }
+#endif
+    for (size_t i = VARIANTS_LEN; i > 0; i--) {
+        if (all_variants[i - 1]->supported()) {
+            selected = all_variants[i - 1];
+            return;
+        }
+    }
+}
+
+#if defined(ARDUINO) || defined(__AVR__)
+const bip39_kernel_variant* bip39_selected_variant() {
+    return selected;
+}
+#else
+static pthread_once_t select_once = PTHREAD_ONCE_INIT;
+
+const bip39_kernel_variant* bip39_selected_variant() {
+    pthread_once(&select_once, select_variant);
+    return selected;
+}
+#endif
+
+size_t bip39_kernel_variants(const bip39_kernel_variant* const** variants) {
+    *variants = all_variants;
+    return VARIANTS_LEN;
+}
+
+const bip39_kernel* bip39_kernel_for_secret_len(size_t secret_len) {
+    if (secret_len < 16 || secret_len > 32 || secret_len % 4 != 0) {
+        return NULL;
+    }
+    return &bip39_selected_variant()->kernels[(secret_len - 16) / 4];
+}
+
+const bip39_kernel* bip39_kernel_for_words_len(size_t words_len) {
+    if (words_len < 12 || words_len > 24 || words_len % 3 != 0) {
+        return NULL;
+    }
+    return &bip39_selected_variant()->kernels[(words_len - 12) / 3];
+}
+
+const char* bip39_kernel_name() {
+    return bip39_selected_variant()->name;
+}
+
+// Deterministic test inputs: a xorshift sequence, plus all-zero and all-one
+// secrets for the edge cases.
+static void test_secret(uint32_t* state, size_t n, uint8_t* secret, size_t secret_len) {
+    for (size_t i = 0; i < secret_len; i++) {
+        if (n == 0) {
+            secret[i] = 0x00;
+        } else if (n == 1) {
+            secret[i] = 0xFF;
+        } else {
+            *state ^= *state << 13;
+            *state ^= *state >> 17;
+            *state ^= *state << 5;
+            secret[i] = *state;
+        }
+    }
+}
+
+// Searches for every slot of a pseudo-random table and for keys just off
+// them.
+static bool test_find_slot(uint32_t* state, bip39_slot_search find_slot) {
+    uint64_t* slots = malloc(BIP39_SLOTS_LEN * sizeof(uint64_t));
+    for (size_t i = 0; i < BIP39_SLOTS_LEN; i++) {
+        uint8_t bytes[8];
+        test_secret(state, 2, bytes, sizeof(bytes));
+        memcpy(&slots[i], bytes, sizeof(bytes));
+    }
+    bool result = true;
+    for (size_t i = 0; i < BIP39_SLOTS_LEN && result; i++) {
+        uint64_t near = slots[i] ^ 1;
+        result = find_slot(slots, slots[i]) == bip39_find_slot_scalar(slots, slots[i]) &&
+            find_slot(slots, near) == bip39_find_slot_scalar(slots, near);
+    }
+    free(slots);
+    return result;
+}
+
+bool bip39_kernel_self_test(size_t rounds) {
+    bool result = true;
+    uint32_t state = 0x2545F491;
+    for (size_t v = 1; v < VARIANTS_LEN && result; v++) {
+        const bip39_kernel_variant* variant = all_variants[v];
+        if (!variant->supported()) {
+            continue;
+        }
+        result = test_find_slot(&state, variant->find_slot);
+        for (size_t k = 0; k < 5 && result; k++) {
+            const bip39_kernel* reference = &bip39_scalar_variant.kernels[k];
+            const bip39_kernel* kernel = &variant->kernels[k];
+            for (size_t n = 0; n < rounds + 2 && result; n++) {
+                uint8_t secret[32];
+                test_secret(&state, n, secret, kernel->secret_len);
+
+                uint16_t expected_words[24];
+                uint16_t words[24];
+                reference->encode(secret, expected_words);
+                kernel->encode(secret, words);
+                result = memcmp(words, expected_words, kernel->words_len * sizeof(uint16_t)) == 0;
+
+                // Also decode a phrase whose checksum is (usually) broken.
+                for (int corrupt = 0; corrupt < 2 && result; corrupt++) {
+                    words[kernel->words_len - 1] ^= corrupt;
+                    uint8_t expected_secret[32];
+                    uint8_t decoded[32];
+                    bool expected_valid = reference->decode(words, expected_secret);
+                    bool valid = kernel->decode(words, decoded);
+                    result = valid == expected_valid &&
+                        memcmp(decoded, expected_secret, kernel->secret_len) == 0;
+                    memzero(expected_secret, sizeof(expected_secret));
+                    memzero(decoded, sizeof(decoded));
+                }
+                memzero(secret, sizeof(secret));
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,64 @@
+#ifndef ARDUINO
+
+#include "entropy.h"
+
+#include <errno.h>
+
+#if defined(__linux__)
+#include <sys/random.h>
+#elif defined(__APPLE__)
+#include <sys/random.h>
+#include <unistd.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+bool bip39_random_bytes(uint8_t* buf, size_t len) {
+#if defined(__linux__)
+    while (len > 0) {
+        ssize_t n = getrandom(buf, len, 0);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        buf += n;
+        len -= n;
+    }
+    return true;
+#elif defined(__APPLE__)
+    // getentropy is limited to 256 bytes per call.
+    while (len > 0) {
+        size_t n = len < 256 ? len : 256;
+        if (getentropy(buf, n) != 0) {
+            return false;
+        }
+        buf += n;
+        len -= n;
+    }
+    return true;
+#else
+    int fd = open("/dev/urandom", O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    while (len > 0) {
+        ssize_t n = read(fd, buf, len);
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            close(fd);
+            return false;
+        }
+        buf += n;
+        len -= n;
+    }
+    close(fd);
+    return true;
+#endif
+}
+
+#endif /* ARDUINO */
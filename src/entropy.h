@@ -0,0 +1,12 @@
+#ifndef ENTROPY_H
+#define ENTROPY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// Fills `buf` from the operating system's CSPRNG. Returns false if the
+// randomness source is unavailable.
+bool bip39_random_bytes(uint8_t* buf, size_t len);
+
+#endif /* ENTROPY_H */
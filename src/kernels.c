@@ -0,0 +1,338 @@
+#include "kernels.h"
+
+#include <string.h>
+
+#ifdef ARDUINO
+#include "bc-crypto-base.h"
+#else
+#include <bc-crypto-base/bc-crypto-base.h>
+#endif
+
+// Straight-line codecs for the standard secret sizes. Every shift and mask
+// is a constant, so there is no per-word branching or bit bookkeeping. The
+// checksum byte `c` is the first byte of SHA-256(secret); only its top
+// `secret_len / 4` bits reach the last word.
+
+static void encode_16(const uint8_t* s, uint16_t* w) {
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_Raw(s, 16, digest);
+    uint8_t c = digest[0];
+    memzero(digest, sizeof(digest));
+
+    w[0] = ((s[0] << 8 | s[1]) >> 5) & 0x7FF;
+    w[1] = ((s[1] << 8 | s[2]) >> 2) & 0x7FF;
+    w[2] = (((uint32_t)s[2] << 16 | s[3] << 8 | s[4]) >> 7) & 0x7FF;
+    w[3] = ((s[4] << 8 | s[5]) >> 4) & 0x7FF;
+    w[4] = ((s[5] << 8 | s[6]) >> 1) & 0x7FF;
+    w[5] = (((uint32_t)s[6] << 16 | s[7] << 8 | s[8]) >> 6) & 0x7FF;
+    w[6] = ((s[8] << 8 | s[9]) >> 3) & 0x7FF;
+    w[7] = (s[9] << 8 | s[10]) & 0x7FF;
+    w[8] = ((s[11] << 8 | s[12]) >> 5) & 0x7FF;
+    w[9] = ((s[12] << 8 | s[13]) >> 2) & 0x7FF;
+    w[10] = (((uint32_t)s[13] << 16 | s[14] << 8 | s[15]) >> 7) & 0x7FF;
+    w[11] = ((s[15] << 8 | c) >> 4) & 0x7FF;
+}
+
+static bool decode_16(const uint16_t* w, uint8_t* s) {
+    s[0] = w[0] >> 3;
+    s[1] = w[0] << 5 | w[1] >> 6;
+    s[2] = w[1] << 2 | w[2] >> 9;
+    s[3] = w[2] >> 1;
+    s[4] = w[2] << 7 | w[3] >> 4;
+    s[5] = w[3] << 4 | w[4] >> 7;
+    s[6] = w[4] << 1 | w[5] >> 10;
+    s[7] = w[5] >> 2;
+    s[8] = w[5] << 6 | w[6] >> 5;
+    s[9] = w[6] << 3 | w[7] >> 8;
+    s[10] = w[7];
+    s[11] = w[8] >> 3;
+    s[12] = w[8] << 5 | w[9] >> 6;
+    s[13] = w[9] << 2 | w[10] >> 9;
+    s[14] = w[10] >> 1;
+    s[15] = w[10] << 7 | w[11] >> 4;
+
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_Raw(s, 16, digest);
+    bool result = (w[11] & 0x0F) == digest[0] >> 4;
+    memzero(digest, sizeof(digest));
+    return result;
+}
+
+static void encode_20(const uint8_t* s, uint16_t* w) {
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_Raw(s, 20, digest);
+    uint8_t c = digest[0];
+    memzero(digest, sizeof(digest));
+
+    w[0] = ((s[0] << 8 | s[1]) >> 5) & 0x7FF;
+    w[1] = ((s[1] << 8 | s[2]) >> 2) & 0x7FF;
+    w[2] = (((uint32_t)s[2] << 16 | s[3] << 8 | s[4]) >> 7) & 0x7FF;
+    w[3] = ((s[4] << 8 | s[5]) >> 4) & 0x7FF;
+    w[4] = ((s[5] << 8 | s[6]) >> 1) & 0x7FF;
+    w[5] = (((uint32_t)s[6] << 16 | s[7] << 8 | s[8]) >> 6) & 0x7FF;
+    w[6] = ((s[8] << 8 | s[9]) >> 3) & 0x7FF;
+    w[7] = (s[9] << 8 | s[10]) & 0x7FF;
+    w[8] = ((s[11] << 8 | s[12]) >> 5) & 0x7FF;
+    w[9] = ((s[12] << 8 | s[13]) >> 2) & 0x7FF;
+    w[10] = (((uint32_t)s[13] << 16 | s[14] << 8 | s[15]) >> 7) & 0x7FF;
+    w[11] = ((s[15] << 8 | s[16]) >> 4) & 0x7FF;
+    w[12] = ((s[16] << 8 | s[17]) >> 1) & 0x7FF;
+    w[13] = (((uint32_t)s[17] << 16 | s[18] << 8 | s[19]) >> 6) & 0x7FF;
+    w[14] = ((s[19] << 8 | c) >> 3) & 0x7FF;
+}
+
+static bool decode_20(const uint16_t* w, uint8_t* s) {
+    s[0] = w[0] >> 3;
+    s[1] = w[0] << 5 | w[1] >> 6;
+    s[2] = w[1] << 2 | w[2] >> 9;
+    s[3] = w[2] >> 1;
+    s[4] = w[2] << 7 | w[3] >> 4;
+    s[5] = w[3] << 4 | w[4] >> 7;
+    s[6] = w[4] << 1 | w[5] >> 10;
+    s[7] = w[5] >> 2;
+    s[8] = w[5] << 6 | w[6] >> 5;
+    s[9] = w[6] << 3 | w[7] >> 8;
+    s[10] = w[7];
+    s[11] = w[8] >> 3;
+    s[12] = w[8] << 5 | w[9] >> 6;
+    s[13] = w[9] << 2 | w[10] >> 9;
+    s[14] = w[10] >> 1;
+    s[15] = w[10] << 7 | w[11] >> 4;
+    s[16] = w[11] << 4 | w[12] >> 7;
+    s[17] = w[12] << 1 | w[13] >> 10;
+    s[18] = w[13] >> 2;
+    s[19] = w[13] << 6 | w[14] >> 5;
+
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_Raw(s, 20, digest);
+    bool result = (w[14] & 0x1F) == digest[0] >> 3;
+    memzero(digest, sizeof(digest));
+    return result;
+}
+
+static void encode_24(const uint8_t* s, uint16_t* w) {
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_Raw(s, 24, digest);
+    uint8_t c = digest[0];
+    memzero(digest, sizeof(digest));
+
+    w[0] = ((s[0] << 8 | s[1]) >> 5) & 0x7FF;
+    w[1] = ((s[1] << 8 | s[2]) >> 2) & 0x7FF;
+    w[2] = (((uint32_t)s[2] << 16 | s[3] << 8 | s[4]) >> 7) & 0x7FF;
+    w[3] = ((s[4] << 8 | s[5]) >> 4) & 0x7FF;
+    w[4] = ((s[5] << 8 | s[6]) >> 1) & 0x7FF;
+    w[5] = (((uint32_t)s[6] << 16 | s[7] << 8 | s[8]) >> 6) & 0x7FF;
+    w[6] = ((s[8] << 8 | s[9]) >> 3) & 0x7FF;
+    w[7] = (s[9] << 8 | s[10]) & 0x7FF;
+    w[8] = ((s[11] << 8 | s[12]) >> 5) & 0x7FF;
+    w[9] = ((s[12] << 8 | s[13]) >> 2) & 0x7FF;
+    w[10] = (((uint32_t)s[13] << 16 | s[14] << 8 | s[15]) >> 7) & 0x7FF;
+    w[11] = ((s[15] << 8 | s[16]) >> 4) & 0x7FF;
+    w[12] = ((s[16] << 8 | s[17]) >> 1) & 0x7FF;
+    w[13] = (((uint32_t)s[17] << 16 | s[18] << 8 | s[19]) >> 6) & 0x7FF;
+    w[14] = ((s[19] << 8 | s[20]) >> 3) & 0x7FF;
+    w[15] = (s[20] << 8 | s[21]) & 0x7FF;
+    w[16] = ((s[22] << 8 | s[23]) >> 5) & 0x7FF;
+    w[17] = ((s[23] << 8 | c) >> 2) & 0x7FF;
+}
+
+static bool decode_24(const uint16_t* w, uint8_t* s) {
+    s[0] = w[0] >> 3;
+    s[1] = w[0] << 5 | w[1] >> 6;
+    s[2] = w[1] << 2 | w[2] >> 9;
+    s[3] = w[2] >> 1;
+    s[4] = w[2] << 7 | w[3] >> 4;
+    s[5] = w[3] << 4 | w[4] >> 7;
+    s[6] = w[4] << 1 | w[5] >> 10;
+    s[7] = w[5] >> 2;
+    s[8] = w[5] << 6 | w[6] >> 5;
+    s[9] = w[6] << 3 | w[7] >> 8;
+    s[10] = w[7];
+    s[11] = w[8] >> 3;
+    s[12] = w[8] << 5 | w[9] >> 6;
+    s[13] = w[9] << 2 | w[10] >> 9;
+    s[14] = w[10] >> 1;
+    s[15] = w[10] << 7 | w[11] >> 4;
+    s[16] = w[11] << 4 | w[12] >> 7;
+    s[17] = w[12] << 1 | w[13] >> 10;
+    s[18] = w[13] >> 2;
+    s[19] = w[13] << 6 | w[14] >> 5;
+    s[20] = w[14] << 3 | w[15] >> 8;
+    s[21] = w[15];
+    s[22] = w[16] >> 3;
+    s[23] = w[16] << 5 | w[17] >> 6;
+
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_Raw(s, 24, digest);
+    bool result = (w[17] & 0x3F) == digest[0] >> 2;
+    memzero(digest, sizeof(digest));
+    return result;
+}
+
+static void encode_28(const uint8_t* s, uint16_t* w) {
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_Raw(s, 28, digest);
+    uint8_t c = digest[0];
+    memzero(digest, sizeof(digest));
+
+    w[0] = ((s[0] << 8 | s[1]) >> 5) & 0x7FF;
+    w[1] = ((s[1] << 8 | s[2]) >> 2) & 0x7FF;
+    w[2] = (((uint32_t)s[2] << 16 | s[3] << 8 | s[4]) >> 7) & 0x7FF;
+    w[3] = ((s[4] << 8 | s[5]) >> 4) & 0x7FF;
+    w[4] = ((s[5] << 8 | s[6]) >> 1) & 0x7FF;
+    w[5] = (((uint32_t)s[6] << 16 | s[7] << 8 | s[8]) >> 6) & 0x7FF;
+    w[6] = ((s[8] << 8 | s[9]) >> 3) & 0x7FF;
+    w[7] = (s[9] << 8 | s[10]) & 0x7FF;
+    w[8] = ((s[11] << 8 | s[12]) >> 5) & 0x7FF;
+    w[9] = ((s[12] << 8 | s[13]) >> 2) & 0x7FF;
+    w[10] = (((uint32_t)s[13] << 16 | s[14] << 8 | s[15]) >> 7) & 0x7FF;
+    w[11] = ((s[15] << 8 | s[16]) >> 4) & 0x7FF;
+    w[12] = ((s[16] << 8 | s[17]) >> 1) & 0x7FF;
+    w[13] = (((uint32_t)s[17] << 16 | s[18] << 8 | s[19]) >> 6) & 0x7FF;
+    w[14] = ((s[19] << 8 | s[20]) >> 3) & 0x7FF;
+    w[15] = (s[20] << 8 | s[21]) & 0x7FF;
+    w[16] = ((s[22] << 8 | s[23]) >> 5) & 0x7FF;
+    w[17] = ((s[23] << 8 | s[24]) >> 2) & 0x7FF;
+    w[18] = (((uint32_t)s[24] << 16 | s[25] << 8 | s[26]) >> 7) & 0x7FF;
+    w[19] = ((s[26] << 8 | s[27]) >> 4) & 0x7FF;
+    w[20] = ((s[27] << 8 | c) >> 1) & 0x7FF;
+}
+
+static bool decode_28(const uint16_t* w, uint8_t* s) {
+    s[0] = w[0] >> 3;
+    s[1] = w[0] << 5 | w[1] >> 6;
+    s[2] = w[1] << 2 | w[2] >> 9;
+    s[3] = w[2] >> 1;
+    s[4] = w[2] << 7 | w[3] >> 4;
+    s[5] = w[3] << 4 | w[4] >> 7;
+    s[6] = w[4] << 1 | w[5] >> 10;
+    s[7] = w[5] >> 2;
+    s[8] = w[5] << 6 | w[6] >> 5;
+    s[9] = w[6] << 3 | w[7] >> 8;
+    s[10] = w[7];
+    s[11] = w[8] >> 3;
+    s[12] = w[8] << 5 | w[9] >> 6;
+    s[13] = w[9] << 2 | w[10] >> 9;
+    s[14] = w[10] >> 1;
+    s[15] = w[10] << 7 | w[11] >> 4;
+    s[16] = w[11] << 4 | w[12] >> 7;
+    s[17] = w[12] << 1 | w[13] >> 10;
+    s[18] = w[13] >> 2;
+    s[19] = w[13] << 6 | w[14] >> 5;
+    s[20] = w[14] << 3 | w[15] >> 8;
+    s[21] = w[15];
+    s[22] = w[16] >> 3;
+    s[23] = w[16] << 5 | w[17] >> 6;
+    s[24] = w[17] << 2 | w[18] >> 9;
+    s[25] = w[18] >> 1;
+    s[26] = w[18] << 7 | w[19] >> 4;
+    s[27] = w[19] << 4 | w[20] >> 7;
+
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_Raw(s, 28, digest);
+    bool result = (w[20] & 0x7F) == digest[0] >> 1;
+    memzero(digest, sizeof(digest));
+    return result;
+}
+
+static void encode_32(const uint8_t* s, uint16_t* w) {
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_Raw(s, 32, digest);
+    uint8_t c = digest[0];
+    memzero(digest, sizeof(digest));
+
+    w[0] = ((s[0] << 8 | s[1]) >> 5) & 0x7FF;
+    w[1] = ((s[1] << 8 | s[2]) >> 2) & 0x7FF;
+    w[2] = (((uint32_t)s[2] << 16 | s[3] << 8 | s[4]) >> 7) & 0x7FF;
+    w[3] = ((s[4] << 8 | s[5]) >> 4) & 0x7FF;
+    w[4] = ((s[5] << 8 | s[6]) >> 1) & 0x7FF;
+    w[5] = (((uint32_t)s[6] << 16 | s[7] << 8 | s[8]) >> 6) & 0x7FF;
+    w[6] = ((s[8] << 8 | s[9]) >> 3) & 0x7FF;
+    w[7] = (s[9] << 8 | s[10]) & 0x7FF;
+    w[8] = ((s[11] << 8 | s[12]) >> 5) & 0x7FF;
+    w[9] = ((s[12] << 8 | s[13]) >> 2) & 0x7FF;
+    w[10] = (((uint32_t)s[13] << 16 | s[14] << 8 | s[15]) >> 7) & 0x7FF;
+    w[11] = ((s[15] << 8 | s[16]) >> 4) & 0x7FF;
+    w[12] = ((s[16] << 8 | s[17]) >> 1) & 0x7FF;
+    w[13] = (((uint32_t)s[17] << 16 | s[18] << 8 | s[19]) >> 6) & 0x7FF;
+    w[14] = ((s[19] << 8 | s[20]) >> 3) & 0x7FF;
+    w[15] = (s[20] << 8 | s[21]) & 0x7FF;
+    w[16] = ((s[22] << 8 | s[23]) >> 5) & 0x7FF;
+    w[17] = ((s[23] << 8 | s[24]) >> 2) & 0x7FF;
+    w[18] = (((uint32_t)s[24] << 16 | s[25] << 8 | s[26]) >> 7) & 0x7FF;
+    w[19] = ((s[26] << 8 | s[27]) >> 4) & 0x7FF;
+    w[20] = ((s[27] << 8 | s[28]) >> 1) & 0x7FF;
+    w[21] = (((uint32_t)s[28] << 16 | s[29] << 8 | s[30]) >> 6) & 0x7FF;
+    w[22] = ((s[30] << 8 | s[31]) >> 3) & 0x7FF;
+    w[23] = (s[31] << 8 | c) & 0x7FF;
+}
+
+static bool decode_32(const uint16_t* w, uint8_t* s) {
+    s[0] = w[0] >> 3;
+    s[1] = w[0] << 5 | w[1] >> 6;
+    s[2] = w[1] << 2 | w[2] >> 9;
+    s[3] = w[2] >> 1;
+    s[4] = w[2] << 7 | w[3] >> 4;
+    s[5] = w[3] << 4 | w[4] >> 7;
+    s[6] = w[4] << 1 | w[5] >> 10;
+    s[7] = w[5] >> 2;
+    s[8] = w[5] << 6 | w[6] >> 5;
+    s[9] = w[6] << 3 | w[7] >> 8;
+    s[10] = w[7];
+    s[11] = w[8] >> 3;
+    s[12] = w[8] << 5 | w[9] >> 6;
+    s[13] = w[9] << 2 | w[10] >> 9;
+    s[14] = w[10] >> 1;
+    s[15] = w[10] << 7 | w[11] >> 4;
+    s[16] = w[11] << 4 | w[12] >> 7;
+    s[17] = w[12] << 1 | w[13] >> 10;
+    s[18] = w[13] >> 2;
+    s[19] = w[13] << 6 | w[14] >> 5;
+    s[20] = w[14] << 3 | w[15] >> 8;
+    s[21] = w[15];
+    s[22] = w[16] >> 3;
+    s[23] = w[16] << 5 | w[17] >> 6;
+    s[24] = w[17] << 2 | w[18] >> 9;
+    s[25] = w[18] >> 1;
+    s[26] = w[18] << 7 | w[19] >> 4;
+    s[27] = w[19] << 4 | w[20] >> 7;
+    s[28] = w[20] << 1 | w[21] >> 10;
+    s[29] = w[21] >> 2;
+    s[30] = w[21] << 6 | w[22] >> 5;
+    s[31] = w[22] << 3 | w[23] >> 8;
+
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_Raw(s, 32, digest);
+    bool result = (w[23] & 0xFF) == digest[0];
+    memzero(digest, sizeof(digest));
+    return result;
+}
+
+static const bip39_kernel scalar_kernels[] = {
+    { 16, 12, encode_16, decode_16 },
+    { 20, 15, encode_20, decode_20 },
+    { 24, 18, encode_24, decode_24 },
+    { 28, 21, encode_28, decode_28 },
+    { 32, 24, encode_32, decode_32 },
+};
+
+int16_t bip39_find_slot_scalar(const uint64_t* slots, uint64_t key) {
+    uint64_t index = 0;
+    uint64_t found = 0;
+    for (uint64_t i = 0; i < BIP39_SLOTS_LEN; i++) {
+        uint64_t x = slots[i] ^ key;
+        // All ones if x is zero, else zero.
+        uint64_t eq = ((x | (0 - x)) >> 63) - 1;
+        index |= eq & i;
+        found |= eq;
+    }
+    return (int16_t)((index & found) | ~found);
+}
+
+static bool scalar_supported() {
+    return true;
+}
+
+const bip39_kernel_variant bip39_scalar_variant = {
+    "scalar", scalar_supported, scalar_kernels, bip39_find_slot_scalar
+};
@@ -0,0 +1,51 @@
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// Encoder and decoder specialized for one standard secret size.
+// `encode` writes the words for a secret, checksum included. `decode` writes
+// the secret for a phrase and returns whether its checksum is valid; the
+// words must already be in range.
+typedef struct bip39_kernel_t {
+    size_t secret_len;
+    size_t words_len;
+    void (*encode)(const uint8_t* secret, uint16_t* words);
+    bool (*decode)(const uint16_t* words, uint8_t* secret);
+} bip39_kernel;
+
+// Searches the 2048 word slots of the constant-time lookup (each word
+// NUL-padded to 8 bytes) for `key` without branching on either. Returns the
+// matching index, or -1.
+#define BIP39_SLOTS_LEN 2048
+typedef int16_t (*bip39_slot_search)(const uint64_t* slots, uint64_t key);
+
+// A set of kernels for the five standard sizes, in ascending order, and a
+// slot search, built for one instruction set. `supported` reports whether
+// the running CPU can execute it.
+typedef struct bip39_kernel_variant_t {
+    const char* name;
+    bool (*supported)(void);
+    const bip39_kernel* kernels;
+    bip39_slot_search find_slot;
+} bip39_kernel_variant;
+
+// The portable reference implementation, always supported.
+extern const bip39_kernel_variant bip39_scalar_variant;
+int16_t bip39_find_slot_scalar(const uint64_t* slots, uint64_t key);
+
+// Returns the kernel for a 16, 20, 24, 28 or 32-byte secret (12, 15, 18, 21
+// or 24 words) from the variant selected for this CPU, or NULL for any
+// other size.
+const bip39_kernel* bip39_kernel_for_secret_len(size_t secret_len);
+const bip39_kernel* bip39_kernel_for_words_len(size_t words_len);
+
+// Returns the variant selected for this CPU.
+const bip39_kernel_variant* bip39_selected_variant(void);
+
+// Returns every variant compiled in, the scalar reference first.
+size_t bip39_kernel_variants(const bip39_kernel_variant* const** variants);
+
+#endif /* KERNELS_H */
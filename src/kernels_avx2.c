@@ -0,0 +1,43 @@
+#include "kernels.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(ARDUINO)
+
+#include <immintrin.h>
+
+// AVX2 slot search, compared four slots at a time. Every CPU with AVX2 that
+// this library targets also has BMI2, so the variant reuses those codecs.
+
+extern const bip39_kernel bip39_bmi2_kernels[];
+
+__attribute__((target("avx2")))
+static int16_t find_slot_avx2(const uint64_t* slots, uint64_t key) {
+    const __m256i k = _mm256_set1_epi64x(key);
+    const __m256i step = _mm256_set1_epi64x(4);
+    __m256i lanes = _mm256_setr_epi64x(0, 1, 2, 3);
+    __m256i index = _mm256_setzero_si256();
+    __m256i found = _mm256_setzero_si256();
+    for (size_t i = 0; i < BIP39_SLOTS_LEN; i += 4) {
+        __m256i eq = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(slots + i)), k);
+        index = _mm256_or_si256(index, _mm256_and_si256(eq, lanes));
+        found = _mm256_or_si256(found, eq);
+        lanes = _mm256_add_epi64(lanes, step);
+    }
+    uint64_t index_lanes[4];
+    uint64_t found_lanes[4];
+    _mm256_storeu_si256((__m256i*)index_lanes, index);
+    _mm256_storeu_si256((__m256i*)found_lanes, found);
+    uint64_t i = index_lanes[0] | index_lanes[1] | index_lanes[2] | index_lanes[3];
+    uint64_t f = found_lanes[0] | found_lanes[1] | found_lanes[2] | found_lanes[3];
+    return (int16_t)((i & f) | ~f);
+}
+
+static bool avx2_supported() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2");
+}
+
+const bip39_kernel_variant bip39_avx2_variant = {
+    "avx2", avx2_supported, bip39_bmi2_kernels, find_slot_avx2
+};
+
+#endif
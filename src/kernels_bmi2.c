@@ -0,0 +1,125 @@
+#include "kernels.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(ARDUINO)
+
+#include <immintrin.h>
+#include <string.h>
+
+#include <bc-crypto-base/bc-crypto-base.h>
+
+// BMI2 codecs. Four 11-bit words are 44 contiguous bits of the payload, so
+// PDEP scatters them into four 16-bit lanes in one instruction, and PEXT
+// gathers them back.
+
+#define LANES_MASK 0x07FF07FF07FF07FFULL
+
+// Payload (secret plus checksum byte) padded so that every 8-byte load and
+// store stays in bounds.
+#define PAYLOAD_MAX (32 + 1 + 8)
+
+static inline uint64_t load_be64(const uint8_t* p) {
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return __builtin_bswap64(v);
+}
+
+static inline void store_be64(uint8_t* p, uint64_t v) {
+    v = __builtin_bswap64(v);
+    memcpy(p, &v, 8);
+}
+
+__attribute__((target("bmi2")))
+static inline void unpack_words(const uint8_t* payload, size_t words_len, uint16_t* words) {
+    for (size_t i = 0; i < words_len; i += 4) {
+        size_t bit = i * 11;
+        uint64_t bits = load_be64(payload + bit / 8) << (bit % 8) >> 20;
+        uint64_t lanes = _pdep_u64(bits, LANES_MASK);
+        words[i] = lanes >> 48;
+        words[i + 1] = lanes >> 32;
+        words[i + 2] = lanes >> 16;
+        words[i + 3] = lanes;
+    }
+}
+
+__attribute__((target("bmi2")))
+static inline void pack_words(const uint16_t* words, size_t words_len, uint8_t* payload) {
+    memset(payload, 0, PAYLOAD_MAX);
+    for (size_t i = 0; i < words_len; i += 4) {
+        uint64_t lanes = (uint64_t)words[i] << 48 | (uint64_t)words[i + 1] << 32 |
+            (uint64_t)words[i + 2] << 16 | words[i + 3];
+        uint64_t bits = _pext_u64(lanes, LANES_MASK);
+        size_t bit = i * 11;
+        uint8_t* p = payload + bit / 8;
+        store_be64(p, load_be64(p) | bits << 20 >> (bit % 8));
+    }
+}
+
+__attribute__((target("bmi2")))
+static inline void encode(const uint8_t* secret, size_t secret_len, uint16_t* words) {
+    uint8_t payload[PAYLOAD_MAX] = { 0 };
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_Raw(secret, secret_len, digest);
+    memcpy(payload, secret, secret_len);
+    payload[secret_len] = digest[0];
+
+    uint16_t all_words[24 + 3];
+    size_t words_len = secret_len * 3 / 4;
+    unpack_words(payload, words_len, all_words);
+    memcpy(words, all_words, words_len * sizeof(uint16_t));
+
+    memzero(payload, sizeof(payload));
+    memzero(digest, sizeof(digest));
+    memzero(all_words, sizeof(all_words));
+}
+
+__attribute__((target("bmi2")))
+static inline bool decode(const uint16_t* words, size_t words_len, uint8_t* secret) {
+    uint16_t all_words[24 + 3] = { 0 };
+    memcpy(all_words, words, words_len * sizeof(uint16_t));
+    uint8_t payload[PAYLOAD_MAX];
+    pack_words(all_words, words_len, payload);
+
+    size_t secret_len = words_len * 4 / 3;
+    uint8_t checksum_bits = secret_len / 4;
+    memcpy(secret, payload, secret_len);
+
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_Raw(secret, secret_len, digest);
+    bool result = (words[words_len - 1] & ((1 << checksum_bits) - 1)) == digest[0] >> (8 - checksum_bits);
+
+    memzero(payload, sizeof(payload));
+    memzero(digest, sizeof(digest));
+    memzero(all_words, sizeof(all_words));
+    return result;
+}
+
+#define BMI2_KERNEL(n) \
+    __attribute__((target("bmi2"))) \
+    static void encode_##n(const uint8_t* secret, uint16_t* words) { encode(secret, n, words); } \
+    __attribute__((target("bmi2"))) \
+    static bool decode_##n(const uint16_t* words, uint8_t* secret) { return decode(words, n * 3 / 4, secret); }
+
+BMI2_KERNEL(16)
+BMI2_KERNEL(20)
+BMI2_KERNEL(24)
+BMI2_KERNEL(28)
+BMI2_KERNEL(32)
+
+const bip39_kernel bip39_bmi2_kernels[] = {
+    { 16, 12, encode_16, decode_16 },
+    { 20, 15, encode_20, decode_20 },
+    { 24, 18, encode_24, decode_24 },
+    { 28, 21, encode_28, decode_28 },
+    { 32, 24, encode_32, decode_32 },
+};
+
+static bool bmi2_supported() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("bmi2");
+}
+
+const bip39_kernel_variant bip39_bmi2_variant = {
+    "bmi2", bmi2_supported, bip39_bmi2_kernels, bip39_find_slot_scalar
+};
+
+#endif
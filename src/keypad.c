@@ -0,0 +1,554 @@
+#include "keypad.h"
+
+const uint32_t bip39_keypad_keys[] PROGMEM = {
+    0x11111320, 0x11126600, 0x11132257, 0x11132456, 0x11135000, 0x11142000,
+    0x11152550, 0x11155000, 0x11157570, 0x11176200, 0x11177600, 0x11180000,
+    0x11232000, 0x11300000, 0x11320000, 0x11320000, 0x11332720, 0x11343780,
+    0x11415120, 0x11415580, 0x11420000, 0x11420000, 0x11440000, 0x11440000,
+    0x11450000, 0x11500000, 0x11512400, 0x11514000, 0x11515100, 0x11515500,
+    0x11526100, 0x11528000, 0x11552000, 0x11552600, 0x11555500, 0x11560000,
+    0x11571600, 0x11572000, 0x11576731, 0x11577000, 0x11585500, 0x11600000,
+    0x11600000, 0x11611420, 0x11615500, 0x11620000, 0x11620000, 0x11620000,
+    0x11624800, 0x11625700, 0x11630000, 0x11631000, 0x11631350, 0x11635000,
+    0x11635500, 0x11637140, 0x11642700, 0x11656100, 0x11656600, 0x11662400,
+    0x11662700, 0x11668000, 0x11670000, 0x11671350, 0x11671400, 0x11673620,
+    0x11674200, 0x11676117, 0x11676200, 0x11700000, 0x11700000, 0x11713000,
+    0x11714530, 0x11720000, 0x11723568, 0x11733700, 0x11735500, 0x11756000,
+    0x11762000, 0x11762000, 0x11762660, 0x11771400, 0x11773550, 0x11774200,
+    0x11774200, 0x12113000, 0x12117620, 0x12150000, 0x12155200, 0x12167000,
+    0x12177800, 0x12200000, 0x12213600, 0x12220000, 0x12231700, 0x12256200,
+    0x12256200, 0x12262660, 0x12317200, 0x12335000, 0x12335200, 0x12343530,
+    0x12426800, 0x12432720, 0x12458000, 0x12470000, 0x12476700, 0x12513000,
+    0x12522370, 0x12525700, 0x12537000, 0x12567600, 0x12577680, 0x12613200,
+    0x12621400, 0x12651310, 0x12670000, 0x12671350, 0x12715120, 0x12731200,
+    0x12747000, 0x12761800, 0x12772600, 0x12782250, 0x12855200, 0x13135000,
+    0x13136000, 0x13144000, 0x13153200, 0x13156000, 0x13156355, 0x13162000,
+    0x13163200, 0x13167260, 0x13170000, 0x13181420, 0x13200000, 0x13200000,
+    0x13212000, 0x13214000, 0x13216000, 0x13220000, 0x13226200, 0x13257000,
+    0x13266800, 0x13267000, 0x13314250, 0x13316000, 0x13322000, 0x13342000,
+    0x13355280, 0x13420000, 0x13500000, 0x13520000, 0x13531200, 0x13545380,
+    0x13551555, 0x13556200, 0x13600000, 0x13614200, 0x13620000, 0x13622000,
+    0x13642000, 0x13655310, 0x13665670, 0x13673000, 0x13714420, 0x13734000,
+    0x13738250, 0x13754000, 0x13765000, 0x13772600, 0x13780000, 0x14114000,
+    0x14122000, 0x14135000, 0x14152000, 0x14153540, 0x14154270, 0x14160000,
+    0x14163280, 0x14165000, 0x14167000, 0x14175000, 0x14180000, 0x14180000,
+    0x14214000, 0x14215000, 0x14264000, 0x14266000, 0x14267000, 0x14272600,
+    0x14314000, 0x14322000, 0x14325000, 0x14325700, 0x14351000, 0x14352000,
+    0x14353100, 0x14360000, 0x14400000, 0x14428000, 0x14458000, 0x14514000,
+    0x14530000, 0x14552000, 0x14552000, 0x14556700, 0x14562000, 0x14566550,
+    0x14572000, 0x14573000, 0x14576200, 0x14585000, 0x14621280, 0x14631000,
+    0x14650000, 0x14710000, 0x14720000, 0x14726000, 0x14756000, 0x14760000,
+    0x14763000, 0x14767260, 0x14771300, 0x14818600, 0x15113000, 0x15132570,
+    0x15135600, 0x15148670, 0x15155770, 0x15162000, 0x15167000, 0x15170000,
+    0x15172760, 0x15183530, 0x15220000, 0x15222200, 0x15280000, 0x15326000,
+    0x15340000, 0x15340000, 0x15342000, 0x15350000, 0x15351400, 0x15368000,
+    0x15442000, 0x15442170, 0x15456000, 0x15475500, 0x15510000, 0x15512670,
+    0x15513520, 0x15520000, 0x15520000, 0x15523650, 0x15525670, 0x15527170,
+    0x15531000, 0x15536266, 0x15540000, 0x15540000, 0x15540000, 0x15552170,
+    0x15553000, 0x15555500, 0x15557512, 0x15561580, 0x15563226, 0x15567000,
+    0x15571400, 0x15573260, 0x15573512, 0x15575700, 0x15576000, 0x15576540,
+    0x15614000, 0x15620000, 0x15622600, 0x15635300, 0x15650000, 0x15660000,
+    0x15662170, 0x15662600, 0x15665800, 0x15670000, 0x15680000, 0x15682600,
+    0x15713000, 0x15725510, 0x15726000, 0x15736720, 0x15751200, 0x15757680,
+    0x15762200, 0x15763500, 0x15764200, 0x15766200, 0x15775500, 0x15775500,
+    0x15800000, 0x15800000, 0x15800000, 0x15832780, 0x15857200, 0x16114000,
+    0x16114270, 0x16124200, 0x16127000, 0x16130000, 0x16135000, 0x16150000,
+    0x16152000, 0x16152000, 0x16163000, 0x16166000, 0x16167000, 0x16172000,
+    0x16172600, 0x16173100, 0x16184000, 0x16188000, 0x16210000, 0x16212000,
+    0x16215000, 0x16223700, 0x16224000, 0x16228200, 0x16251000, 0x16280000,
+    0x16314000, 0x16314270, 0x16322000, 0x16323200, 0x16333700, 0x16352000,
+    0x16353000, 0x16364000, 0x16366000, 0x16372000, 0x16373100, 0x16400000,
+    0x16500000, 0x16511543, 0x16522000, 0x16542500, 0x16545380, 0x16555000,
+    0x16556000, 0x16558200, 0x16560000, 0x16566000, 0x16571300, 0x16573260,
+    0x16575200, 0x16580000, 0x16582000, 0x16585000, 0x16615320, 0x16617470,
+    0x16621600, 0x16621700, 0x16626700, 0x16627000, 0x16634000, 0x16636700,
+    0x16637200, 0x16642000, 0x16658000, 0x16665720, 0x16675200, 0x16700000,
+    0x16713140, 0x16722117, 0x16724000, 0x16735100, 0x16736200, 0x16736700,
+    0x16751300, 0x16751420, 0x16763000, 0x16763000, 0x16785640, 0x16800000,
+    0x16867140, 0x17114200, 0x17120000, 0x17173550, 0x17221450, 0x17228000,
+    0x17232700, 0x17237000, 0x17261320, 0x17342000, 0x17342720, 0x17376700,
+    0x17410000, 0x17440000, 0x17442700, 0x17477620, 0x17511250, 0x17524200,
+    0x17532000, 0x17542600, 0x17550000, 0x17570000, 0x17600000, 0x17600000,
+    0x17615162, 0x17622500, 0x17632600, 0x17633550, 0x17635266, 0x17635760,
+    0x17662570, 0x17667000, 0x17671350, 0x17672000, 0x17675500, 0x17680000,
+    0x17711400, 0x17720000, 0x17725200, 0x17735600, 0x17737722, 0x17750000,
+    0x17761170, 0x17772600, 0x17775500, 0x17826000, 0x17880000, 0x18142000,
+    0x18142000, 0x18162000, 0x18180000, 0x18265520, 0x18274000, 0x18360000,
+    0x18481620, 0x21120000, 0x21163100, 0x21174780, 0x21200000, 0x21220000,
+    0x21326000, 0x21342000, 0x21350000, 0x21357000, 0x21373000, 0x21440000,
+    0x21462000, 0x21500000, 0x21512000, 0x21513200, 0x21518000, 0x21520000,
+    0x21532600, 0x21534800, 0x21545380, 0x21555580, 0x21557600, 0x21560000,
+    0x21571680, 0x21630000, 0x21633550, 0x21634800, 0x21635300, 0x21648000,
+    0x21650000, 0x21650000, 0x21670000, 0x21673000, 0x21680000, 0x21700000,
+    0x21714000, 0x21732600, 0x21733720, 0x21733726, 0x21747000, 0x21756372,
+    0x21800000, 0x21850000, 0x22112200, 0x22117200, 0x22125126, 0x22132200,
+    0x22140000, 0x22143520, 0x22156172, 0x22162162, 0x22163600, 0x22167168,
+    0x22177620, 0x22200000, 0x22220000, 0x22225620, 0x22226140, 0x22235200,
+    0x22240000, 0x22256700, 0x22260000, 0x22280000, 0x22320000, 0x22362200,
+    0x22370000, 0x22418000, 0x22437260, 0x22512000, 0x22514200, 0x22515200,
+    0x22531400, 0x22536200, 0x22573670, 0x22580000, 0x22616312, 0x22616700,
+    0x22625200, 0x22626700, 0x22633500, 0x22637200, 0x22640000, 0x22656370,
+    0x22661360, 0x22673000, 0x22673714, 0x22676580, 0x22677800, 0x22711720,
+    0x22713000, 0x22713400, 0x22721700, 0x22724560, 0x22726000, 0x22731200,
+    0x22757200, 0x22800000, 0x23120000, 0x23126000, 0x23136150, 0x23140000,
+    0x23155520, 0x23168000, 0x23173550, 0x23222600, 0x23242000, 0x23262400,
+    0x23270000, 0x23300000, 0x23337000, 0x23337140, 0x23353780, 0x23376200,
+    0x23420000, 0x23425510, 0x23450000, 0x23472600, 0x23514000, 0x23520000,
+    0x23520000, 0x23532600, 0x23536300, 0x23552600, 0x23556176, 0x23611400,
+    0x23613622, 0x23615726, 0x23620000, 0x23621620, 0x23621700, 0x23630000,
+    0x23630000, 0x23650000, 0x23653660, 0x23656226, 0x23664180, 0x23667000,
+    0x23670000, 0x23671512, 0x23700000, 0x23726700, 0x23732200, 0x23732600,
+    0x23752660, 0x23756120, 0x23800000, 0x23888000, 0x24130000, 0x24152000,
+    0x24158000, 0x24163000, 0x24170000, 0x24175600, 0x24217631, 0x24220000,
+    0x24226000, 0x24231570, 0x24252570, 0x24263157, 0x24271756, 0x24333700,
+    0x24360000, 0x24372000, 0x24514000, 0x24517000, 0x24556000, 0x24582600,
+    0x24620000, 0x24732000, 0x24763000, 0x24800000, 0x25114200, 0x25116400,
+    0x25117000, 0x25150000, 0x25152800, 0x25161120, 0x25175257, 0x25175600,
+    0x25176000, 0x25200000, 0x25242660, 0x25256120, 0x25256620, 0x25258000,
+    0x25263200, 0x25263800, 0x25300000, 0x25300000, 0x25313200, 0x25315120,
+    0x25335200, 0x25340000, 0x25420000, 0x25436700, 0x25440000, 0x25445800,
+    0x25458000, 0x25463350, 0x25513500, 0x25517200, 0x25520000, 0x25542800,
+    0x25556000, 0x25560000, 0x25570000, 0x25573300, 0x25573550, 0x25612000,
+    0x25620000, 0x25626700, 0x25631300, 0x25632700, 0x25640000, 0x25645800,
+    0x25654400, 0x25658260, 0x25663400, 0x25672600, 0x25675000, 0x25676200,
+    0x25677520, 0x25678000, 0x25681620, 0x25714200, 0x25720000, 0x25724562,
+    0x25726000, 0x25736200, 0x25752000, 0x25768000, 0x25800000, 0x26100000,
+    0x26116200, 0x26127000, 0x26133420, 0x26135500, 0x26151000, 0x26152000,
+    0x26162000, 0x26167310, 0x26180000, 0x26215000, 0x26263000, 0x26266000,
+    0x26267257, 0x26325200, 0x26327000, 0x26344000, 0x26353200, 0x26354000,
+    0x26360000, 0x26365220, 0x26372000, 0x26522000, 0x26530000, 0x26557000,
+    0x26560000, 0x26563550, 0x26567000, 0x26582500, 0x26585000, 0x26618000,
+    0x26625120, 0x26656000, 0x26714000, 0x26717200, 0x26736000, 0x26737000,
+    0x26750000, 0x26767000, 0x26800000, 0x27140000, 0x27240000, 0x27265140,
+    0x27322512, 0x27331600, 0x27340000, 0x27500000, 0x27510000, 0x27520000,
+    0x27542000, 0x27547200, 0x27558000, 0x27635300, 0x27651120, 0x27670000,
+    0x27680000, 0x27713000, 0x27776200, 0x27780000, 0x28117000, 0x28126600,
+    0x28131532, 0x28137200, 0x28147220, 0x28156420, 0x28162000, 0x28176200,
+    0x28200000, 0x28216580, 0x28217720, 0x28261362, 0x28317670, 0x28331370,
+    0x28342000, 0x28367000, 0x28370000, 0x28515310, 0x28573100, 0x28615200,
+    0x28621700, 0x28636200, 0x28641350, 0x28656200, 0x28662660, 0x28725200,
+    0x28761000, 0x31137000, 0x31200000, 0x31232700, 0x31350000, 0x31360000,
+    0x31418800, 0x31420000, 0x31442680, 0x31520000, 0x31520000, 0x31550000,
+    0x31552600, 0x31567260, 0x31600000, 0x31600000, 0x31611320, 0x31613200,
+    0x31615600, 0x31620000, 0x31622500, 0x31643100, 0x31652570, 0x31660000,
+    0x31663000, 0x31668000, 0x31672670, 0x31700000, 0x31720000, 0x31720000,
+    0x31732000, 0x31732600, 0x31816200, 0x31820000, 0x31840000, 0x32120000,
+    0x32147300, 0x32167000, 0x32178000, 0x32210000, 0x32232353, 0x32257328,
+    0x32333700, 0x32420000, 0x32445000, 0x32452700, 0x32460000, 0x32500000,
+    0x32526140, 0x32537600, 0x32562000, 0x32573520, 0x32574200, 0x32650000,
+    0x32677620, 0x33157000, 0x33222500, 0x33270000, 0x33330000, 0x33334200,
+    0x33440000, 0x33532600, 0x33556200, 0x33567000, 0x33570000, 0x33600000,
+    0x33612220, 0x33620000, 0x33640000, 0x33675680, 0x33720000, 0x34120000,
+    0x34151200, 0x34162000, 0x34166000, 0x34322000, 0x34356620, 0x34400000,
+    0x34423140, 0x34452660, 0x34512000, 0x34555000, 0x34568000, 0x34572000,
+    0x34580000, 0x34720000, 0x35118000, 0x35130000, 0x35132000, 0x35142800,
+    0x35147220, 0x35155200, 0x35162162, 0x35170000, 0x35215700, 0x35222660,
+    0x35228000, 0x35231172, 0x35243170, 0x35255600, 0x35256500, 0x35276768,
+    0x35314200, 0x35326370, 0x35371720, 0x35373140, 0x35420000, 0x35420000,
+    0x35420000, 0x35421700, 0x35432180, 0x35445800, 0x35476800, 0x35517200,
+    0x35520000, 0x35520000, 0x35520000, 0x35525620, 0x35526000, 0x35528000,
+    0x35551257, 0x35562000, 0x35575200, 0x35611700, 0x35615200, 0x35620000,
+    0x35621700, 0x35632200, 0x35634410, 0x35650000, 0x35656200, 0x35662000,
+    0x35662400, 0x35663600, 0x35663620, 0x35663714, 0x35665600, 0x35665720,
+    0x35670000, 0x35671440, 0x35673680, 0x35674620, 0x35677000, 0x35711700,
+    0x35724000, 0x35726000, 0x35726267, 0x35726500, 0x35726700, 0x35737200,
+    0x35750000, 0x35754720, 0x35760000, 0x35850000, 0x36110000, 0x36112000,
+    0x36135000, 0x36157000, 0x36162000, 0x36166000, 0x36173780, 0x36217000,
+    0x36225000, 0x36320000, 0x36322000, 0x36370000, 0x36415200, 0x36512680,
+    0x36541720, 0x36550000, 0x36576000, 0x36580000, 0x36672000, 0x36757000,
+    0x37100000, 0x37162000, 0x37250000, 0x37266000, 0x37320000, 0x37322000,
+    0x37347000, 0x37371600, 0x37500000, 0x37514200, 0x37515000, 0x37526220,
+    0x37536800, 0x37556000, 0x37568000, 0x37570000, 0x37611520, 0x37624200,
+    0x37668000, 0x37670000, 0x38163200, 0x38500000, 0x41100000, 0x41124000,
+    0x41142700, 0x41156000, 0x41222600, 0x41280000, 0x41371600, 0x41420000,
+    0x41531655, 0x41537132, 0x41560000, 0x41600000, 0x41632000, 0x41675600,
+    0x41710000, 0x41726000, 0x41733000, 0x41735000, 0x41752680, 0x41800000,
+    0x41826000, 0x41850000, 0x41867370, 0x41880000, 0x41880000, 0x42120000,
+    0x42122600, 0x42145760, 0x42156000, 0x42165000, 0x42172000, 0x42177620,
+    0x42250000, 0x42260000, 0x42270000, 0x42300000, 0x42314000, 0x42325200,
+    0x42367620, 0x42448000, 0x42520000, 0x42537300, 0x42555000, 0x42560000,
+    0x42561620, 0x42665500, 0x42713760, 0x42724000, 0x42772600, 0x42800000,
+    0x42824000, 0x43125620, 0x43126780, 0x43140000, 0x43160000, 0x43161680,
+    0x43200000, 0x43220000, 0x43252800, 0x43270000, 0x43337000, 0x43420000,
+    0x43510000, 0x43520000, 0x43532550, 0x43537000, 0x43540000, 0x43550000,
+    0x43660000, 0x43670000, 0x43673200, 0x43700000, 0x43713250, 0x43720000,
+    0x43720000, 0x43772500, 0x43774200, 0x43816200, 0x43830000, 0x45100000,
+    0x45114000, 0x45120000, 0x45140000, 0x45150000, 0x45167260, 0x45220000,
+    0x45322000, 0x45331000, 0x45350000, 0x45420000, 0x45514000, 0x45524800,
+    0x45530000, 0x45560000, 0x45580000, 0x45720000, 0x45720000, 0x45753200,
+    0x45765280, 0x45772680, 0x45800000, 0x45814000, 0x47148000, 0x47232000,
+    0x47312000, 0x47331320, 0x47512600, 0x47513000, 0x47516000, 0x47534200,
+    0x47535600, 0x47540000, 0x47560000, 0x47670000, 0x47876800, 0x48631600,
+    0x51133520, 0x51176000, 0x51200000, 0x51215000, 0x51280000, 0x51320000,
+    0x51331000, 0x51340000, 0x51350000, 0x51352700, 0x51372000, 0x51400000,
+    0x51420000, 0x51421700, 0x51433200, 0x51456000, 0x51500000, 0x51513200,
+    0x51520000, 0x51521720, 0x51535000, 0x51551400, 0x51563550, 0x51571400,
+    0x51613000, 0x51614200, 0x51617620, 0x51626720, 0x51633500, 0x51635200,
+    0x51640000, 0x51642000, 0x51642700, 0x51643500, 0x51660000, 0x51663132,
+    0x51665800, 0x51672600, 0x51678000, 0x51713000, 0x51713500, 0x51726314,
+    0x51730000, 0x51735500, 0x51735760, 0x51751260, 0x51763800, 0x51772600,
+    0x51776200, 0x51820000, 0x51835750, 0x52125800, 0x52131531, 0x52140000,
+    0x52150000, 0x52160000, 0x52167620, 0x52170000, 0x52200000, 0x52214000,
+    0x52220000, 0x52226000, 0x52231000, 0x52231200, 0x52317372, 0x52342170,
+    0x52373260, 0x52452800, 0x52470000, 0x52512600, 0x52556800, 0x52560000,
+    0x52570000, 0x52573550, 0x52618000, 0x52630000, 0x52632000, 0x52632800,
+    0x52637000, 0x52661320, 0x52668000, 0x52670000, 0x52672000, 0x52700000,
+    0x52714000, 0x52725000, 0x52726000, 0x52735200, 0x52776140, 0x52785640,
+    0x52860000, 0x52870000, 0x53120000, 0x53224200, 0x53253337, 0x53337000,
+    0x53400000, 0x53440000, 0x53443550, 0x53520000, 0x53531000, 0x53535750,
+    0x53556000, 0x53577200, 0x53611420, 0x53626800, 0x53660000, 0x53665600,
+    0x53671420, 0x53800000, 0x53822000, 0x53877620, 0x54180000, 0x54200000,
+    0x54372000, 0x54856310, 0x55120000, 0x55134200, 0x55142000, 0x55200000,
+    0x55224000, 0x55232800, 0x55355000, 0x55362000, 0x55370000, 0x55435200,
+    0x55480000, 0x55500000, 0x55524200, 0x55525700, 0x55535220, 0x55537560,
+    0x55542800, 0x55550000, 0x55567260, 0x55573000, 0x55614000, 0x55620000,
+    0x55620000, 0x55651400, 0x55653530, 0x55667375, 0x55673000, 0x55711420,
+    0x55720000, 0x55720000, 0x55724000, 0x55731200, 0x55732000, 0x55732600,
+    0x55733530, 0x55735500, 0x55756000, 0x55757135, 0x55762000, 0x55800000,
+    0x56131620, 0x56137000, 0x56153200, 0x56226000, 0x56235168, 0x56250000,
+    0x56261000, 0x56315000, 0x56325700, 0x56333514, 0x56353550, 0x56631500,
+    0x56656200, 0x56735500, 0x56763130, 0x57130000, 0x57140000, 0x57142160,
+    0x57223500, 0x57250000, 0x57260000, 0x57326000, 0x57420000, 0x57473648,
+    0x57512600, 0x57614200, 0x57627500, 0x57631000, 0x57636555, 0x57662000,
+    0x57670000, 0x57700000, 0x57725560, 0x57726000, 0x57763220, 0x57767700,
+    0x57771400, 0x58500000, 0x58526000, 0x58552000, 0x58624200, 0x58672600,
+    0x58672680, 0x58730000, 0x58832500, 0x61113700, 0x61115550, 0x61120000,
+    0x61140000, 0x61142000, 0x61150000, 0x61162000, 0x61170000, 0x61177260,
+    0x61200000, 0x61216000, 0x61220000, 0x61224200, 0x61224200, 0x61235000,
+    0x61252000, 0x61252660, 0x61320000, 0x61325120, 0x61325200, 0x61340000,
+    0x61340000, 0x61350000, 0x61355400, 0x61360000, 0x61362000, 0x61366566,
+    0x61411200, 0x61412000, 0x61448000, 0x61450000, 0x61455000, 0x61455500,
+    0x61470000, 0x61477200, 0x61513000, 0x61520000, 0x61520000, 0x61521000,
+    0x61524000, 0x61525500, 0x61531000, 0x61532000, 0x61560000, 0x61564200,
+    0x61566355, 0x61573260, 0x61577000, 0x61612200, 0x61616000, 0x61620000,
+    0x61622500, 0x61625700, 0x61626000, 0x61632000, 0x61636700, 0x61640000,
+    0x61660000, 0x61665700, 0x61671000, 0x61678000, 0x61712000, 0x61713000,
+    0x61720000, 0x61720000, 0x61720000, 0x61725000, 0x61730000, 0x61732570,
+    0x61732600, 0x61736280, 0x61756330, 0x61761320, 0x61762000, 0x61765400,
+    0x61772650, 0x61800000, 0x61800000, 0x61852570, 0x61856000, 0x62100000,
+    0x62112000, 0x62114400, 0x62123720, 0x62124000, 0x62128000, 0x62136200,
+    0x62140000, 0x62155200, 0x62156200, 0x62157700, 0x62160000, 0x62161300,
+    0x62161570, 0x62162700, 0x62165500, 0x62165500, 0x62170000, 0x62173420,
+    0x62173550, 0x62176378, 0x62181420, 0x62220000, 0x62240000, 0x62242170,
+    0x62256500, 0x62271200, 0x62276200, 0x62335500, 0x62352570, 0x62362700,
+    0x62374160, 0x62418000, 0x62421620, 0x62421700, 0x62421700, 0x62431150,
+    0x62432200, 0x62440000, 0x62480000, 0x62500000, 0x62513400, 0x62513500,
+    0x62514780, 0x62522600, 0x62525126, 0x62528000, 0x62535160, 0x62535200,
+    0x62535600, 0x62557200, 0x62562000, 0x62562500, 0x62564200, 0x62570000,
+    0x62572512, 0x62613600, 0x62617200, 0x62621700, 0x62622170, 0x62625142,
+    0x62632600, 0x62636700, 0x62641120, 0x62653700, 0x62656700, 0x62657612,
+    0x62662600, 0x62663550, 0x62665500, 0x62665562, 0x62673120, 0x62673620,
+    0x62674700, 0x62700000, 0x62721400, 0x62725000, 0x62732800, 0x62736200,
+    0x62753550, 0x62762170, 0x62774200, 0x62776000, 0x62776500, 0x62816200,
+    0x63100000, 0x63115500, 0x63120000, 0x63125800, 0x63127000, 0x63130000,
+    0x63140000, 0x63143530, 0x63144580, 0x63153100, 0x63155000, 0x63162000,
+    0x63177620, 0x63212000, 0x63220000, 0x63220000, 0x63220000, 0x63232000,
+    0x63232000, 0x63242000, 0x63244000, 0x63263220, 0x63300000, 0x63324200,
+    0x63325500, 0x63327000, 0x63332000, 0x63337000, 0x63337000, 0x63350000,
+    0x63352000, 0x63360000, 0x63372600, 0x63425700, 0x63440000, 0x63440000,
+    0x63448000, 0x63457000, 0x63472600, 0x63512000, 0x63514000, 0x63520000,
+    0x63530000, 0x63530000, 0x63534160, 0x63540000, 0x63552000, 0x63552260,
+    0x63557000, 0x63560000, 0x63564200, 0x63567000, 0x63570000, 0x63572000,
+    0x63574226, 0x63575000, 0x63616200, 0x63620000, 0x63625000, 0x63635600,
+    0x63640000, 0x63664200, 0x63672600, 0x63673000, 0x63675400, 0x63713000,
+    0x63714000, 0x63722420, 0x63726000, 0x63771400, 0x63771720, 0x63800000,
+    0x63800000, 0x63820000, 0x63863114, 0x63873500, 0x63881000, 0x64110000,
+    0x64112000, 0x64150000, 0x64152700, 0x64167310, 0x64172000, 0x64172000,
+    0x64180000, 0x64216200, 0x64223200, 0x64226000, 0x64252260, 0x64271300,
+    0x64300000, 0x64312000, 0x64322000, 0x64333700, 0x64344000, 0x64350000,
+    0x64350000, 0x64367000, 0x64531500, 0x64570000, 0x64580000, 0x64714000,
+    0x64730000, 0x64744000, 0x64753200, 0x64763000, 0x65112600, 0x65114000,
+    0x65120000, 0x65131400, 0x65140000, 0x65142000, 0x65142700, 0x65144000,
+    0x65157000, 0x65160000, 0x65160000, 0x65167000, 0x65167000, 0x65176700,
+    0x65210000, 0x65250000, 0x65270000, 0x65270000, 0x65322000, 0x65342000,
+    0x65357000, 0x65416000, 0x65416000, 0x65420000, 0x65423260, 0x65431200,
+    0x65432000, 0x65472000, 0x65477355, 0x65515120, 0x65520000, 0x65520000,
+    0x65525520, 0x65530000, 0x65540000, 0x65542000, 0x65543200, 0x65550000,
+    0x65550000, 0x65557300, 0x65580000, 0x65580000, 0x65620000, 0x65637355,
+    0x65663142, 0x65668000, 0x65670000, 0x65670000, 0x65673550, 0x65674160,
+    0x65717200, 0x65717500, 0x65726780, 0x65733000, 0x65740000, 0x65752000,
+    0x65752000, 0x65760000, 0x65761200, 0x65772000, 0x65772680, 0x65773000,
+    0x65814000, 0x65822600, 0x65826000, 0x66112000, 0x66117312, 0x66136200,
+    0x66162000, 0x66173140, 0x66185000, 0x66213140, 0x66214000, 0x66222000,
+    0x66222600, 0x66223170, 0x66244000, 0x66252000, 0x66261620, 0x66262570,
+    0x66272570, 0x66277800, 0x66312000, 0x66312000, 0x66322000, 0x66322600,
+    0x66326200, 0x66342000, 0x66350000, 0x66351680, 0x66356378, 0x66357000,
+    0x66363700, 0x66365500, 0x66371720, 0x66382000, 0x66437000, 0x66512660,
+    0x66514250, 0x66523700, 0x66527120, 0x66534000, 0x66536150, 0x66542170,
+    0x66552000, 0x66555000, 0x66555720, 0x66556560, 0x66562678, 0x66566260,
+    0x66567000, 0x66570000, 0x66572000, 0x66572170, 0x66573220, 0x66618000,
+    0x66621200, 0x66635300, 0x66716200, 0x66722820, 0x66736624, 0x66800000,
+    0x67112600, 0x67112660, 0x67114200, 0x67122000, 0x67123750, 0x67130000,
+    0x67132000, 0x67136600, 0x67142170, 0x67143100, 0x67143780, 0x67152000,
+    0x67153700, 0x67156000, 0x67157750, 0x67167000, 0x67167260, 0x67172000,
+    0x67180000, 0x67181800, 0x67214000, 0x67220000, 0x67222500, 0x67222600,
+    0x67223530, 0x67224000, 0x67250000, 0x67260000, 0x67262500, 0x67267355,
+    0x67300000, 0x67314000, 0x67314000, 0x67316000, 0x67332670, 0x67344000,
+    0x67353000, 0x67370000, 0x67370000, 0x67380000, 0x67420000, 0x67440000,
+    0x67460000, 0x67462000, 0x67500000, 0x67500000, 0x67513000, 0x67514000,
+    0x67551130, 0x67552000, 0x67552600, 0x67554000, 0x67558000, 0x67562700,
+    0x67564350, 0x67568000, 0x67572000, 0x67572000, 0x67581800, 0x67613162,
+    0x67614000, 0x67617238, 0x67620000, 0x67621120, 0x67622700, 0x67626000,
+    0x67630000, 0x67632000, 0x67634000, 0x67634200, 0x67637800, 0x67655300,
+    0x67662000, 0x67662170, 0x67662520, 0x67664800, 0x67665620, 0x67665752,
+    0x67666362, 0x67668000, 0x67671350, 0x67672800, 0x67673342, 0x67700000,
+    0x67722000, 0x67722570, 0x67751420, 0x67842000, 0x67884200, 0x68144580,
+    0x68156000, 0x68160000, 0x68165000, 0x68216000, 0x68227000, 0x68327000,
+    0x68350000, 0x68353000, 0x68371300, 0x68515400, 0x68562000, 0x68567550,
+    0x68615320, 0x68672500, 0x68676000, 0x71115700, 0x71142000, 0x71144200,
+    0x71177500, 0x71300000, 0x71340000, 0x71372000, 0x71425700, 0x71432000,
+    0x71440000, 0x71442800, 0x71472000, 0x71500000, 0x71536300, 0x71540000,
+    0x71620000, 0x71632700, 0x71635760, 0x71640000, 0x71656000, 0x71670000,
+    0x71672000, 0x71747000, 0x71775500, 0x71830000, 0x72113000, 0x72150000,
+    0x72331420, 0x72440000, 0x72472700, 0x72500000, 0x72515700, 0x72525600,
+    0x72553600, 0x72570000, 0x72572000, 0x72577620, 0x72610000, 0x72632800,
+    0x72650000, 0x72662400, 0x72663550, 0x72670000, 0x72680000, 0x72726150,
+    0x72870000, 0x73114200, 0x73135760, 0x73142700, 0x73154000, 0x73161570,
+    0x73170000, 0x73175680, 0x73220000, 0x73225000, 0x73250000, 0x73252000,
+    0x73256800, 0x73262000, 0x73280000, 0x73280000, 0x73326000, 0x73353000,
+    0x73360000, 0x73441320, 0x73470000, 0x73480000, 0x73512600, 0x73520000,
+    0x73543500, 0x73571320, 0x73573370, 0x73580000, 0x73600000, 0x73610000,
+    0x73622000, 0x73622000, 0x73637000, 0x73637200, 0x73658000, 0x73667200,
+    0x73671400, 0x73676000, 0x73677140, 0x73714000, 0x73732000, 0x73742000,
+    0x73751000, 0x73752260, 0x75111150, 0x75114000, 0x75114200, 0x75142000,
+    0x75157260, 0x75162441, 0x75167000, 0x75181620, 0x75200000, 0x75213600,
+    0x75218000, 0x75224260, 0x75226000, 0x75250000, 0x75254200, 0x75312000,
+    0x75316680, 0x75320000, 0x75325650, 0x75327326, 0x75342700, 0x75367200,
+    0x75370000, 0x75372662, 0x75411550, 0x75425000, 0x75451400, 0x75455850,
+    0x75475200, 0x75517500, 0x75520000, 0x75533370, 0x75537200, 0x75540000,
+    0x75556658, 0x75573000, 0x75600000, 0x75613000, 0x75631000, 0x75651250,
+    0x75660000, 0x75664200, 0x75675362, 0x75714000, 0x75720000, 0x75723400,
+    0x75734000, 0x75763670, 0x75767140, 0x75800000, 0x75813200, 0x75816200,
+    0x75826000, 0x75850000, 0x76114000, 0x76115000, 0x76122000, 0x76122310,
+    0x76132000, 0x76133100, 0x76135000, 0x76156226, 0x76160000, 0x76163000,
+    0x76172400, 0x76180000, 0x76200000, 0x76217000, 0x76217200, 0x76220000,
+    0x76220000, 0x76227400, 0x76242660, 0x76252000, 0x76312000, 0x76314000,
+    0x76314000, 0x76320000, 0x76333260, 0x76350000, 0x76354200, 0x76360000,
+    0x76361220, 0x76550000, 0x76563800, 0x76571420, 0x76626000, 0x76627000,
+    0x76714000, 0x76714000, 0x76720000, 0x76748000, 0x76756270, 0x76767000,
+    0x76773000, 0x76800000, 0x77120000, 0x77343780, 0x77373550, 0x77510000,
+    0x77514200, 0x77552400, 0x77642800, 0x77650000, 0x77674200, 0x78247200,
+    0x78257800, 0x78312000, 0x78350000, 0x78367000, 0x78500000, 0x78620000,
+    0x78631140, 0x81320000, 0x81355000, 0x81370000, 0x81440000, 0x81440000,
+    0x81457700, 0x81570000, 0x81620000, 0x81621620, 0x81630000, 0x81650000,
+    0x81660000, 0x81663560, 0x81672000, 0x81720000, 0x81726000, 0x81800000,
+    0x82100000, 0x82147300, 0x82160000, 0x82160000, 0x82161000, 0x82162400,
+    0x82165500, 0x82173260, 0x82223530, 0x82242520, 0x82362000, 0x82415520,
+    0x82445800, 0x82650000, 0x82670000, 0x82700000, 0x83142000, 0x83170000,
+    0x83217000, 0x83220000, 0x83220000, 0x83224000, 0x83250000, 0x83262000,
+    0x83273000, 0x83360000, 0x83366260, 0x83420000, 0x83440000, 0x83500000,
+    0x83520000, 0x83525800, 0x83530000, 0x83540000, 0x83552600, 0x83572600,
+    0x83620000, 0x83620000, 0x83625500, 0x83630000, 0x83752660, 0x85420000,
+    0x85500000, 0x85515000, 0x85520000, 0x85520000, 0x85522600, 0x85540000,
+    0x85620000, 0x85640000, 0x85642000, 0x85668000, 0x85673000, 0x85700000,
+    0x85753000, 0x85773000, 0x86160000, 0x86214000, 0x86267420, 0x86367000,
+    0x86372000, 0x86553000,
+};
+
+const uint16_t bip39_keypad_words[] PROGMEM = {
+    253,  10,   11,   137,  254,  255,  0,    138,  12,   13,
+    256,  136,  139,  140,  15,   257,  14,   1,    141,  142,
+    2,    258,  143,  259,  260,  263,  265,  264,  145,  144,
+    261,  266,  268,  146,  267,  262,  269,  4,    16,   3,
+    270,  147,  274,  271,  275,  151,  276,  281,  148,  5,
+    282,  152,  149,  277,  283,  272,  153,  6,    18,   150,
+    278,  279,  280,  273,  285,  17,   284,  7,    8,    19,
+    286,  288,  287,  294,  289,  291,  20,   21,   9,    292,
+    22,   23,   293,  154,  290,  155,  158,  156,  159,  24,
+    157,  25,   34,   160,  26,   35,   161,  27,   163,  162,
+    164,  295,  296,  165,  166,  167,  28,   168,  169,  297,
+    29,   298,  299,  36,   300,  33,   170,  301,  31,   32,
+    30,   171,  172,  173,  174,  37,   302,  303,  305,  306,
+    304,  309,  308,  307,  310,  175,  38,   176,  41,   312,
+    311,  314,  313,  39,   315,  316,  317,  327,  318,  319,
+    320,  177,  42,   178,  321,  179,  328,  322,  43,   329,
+    180,  40,   45,   323,  44,   181,  324,  332,  330,  325,
+    326,  182,  331,  183,  184,  333,  185,  48,   186,  334,
+    335,  46,   187,  47,   336,  337,  188,  338,  339,  189,
+    49,   340,  341,  343,  50,   342,  344,  190,  345,  346,
+    51,   52,   53,   347,  348,  55,   191,  54,   349,  192,
+    351,  350,  193,  352,  57,   56,   58,   353,  194,  59,
+    354,  195,  196,  355,  356,  60,   357,  68,   67,   66,
+    359,  197,  358,  198,  61,   62,   360,  361,  199,  69,
+    200,  362,  70,   363,  72,   71,   73,   364,  365,  366,
+    201,  373,  367,  202,  368,  375,  369,  374,  370,  376,
+    204,  381,  382,  377,  63,   371,  74,   372,  378,  205,
+    75,   76,   380,  64,   203,  379,  385,  386,  206,  207,
+    387,  209,  388,  383,  208,  389,  384,  77,   391,  78,
+    396,  79,   211,  392,  65,   395,  393,  394,  210,  390,
+    81,   212,  213,  80,   397,  398,  214,  399,  400,  88,
+    215,  401,  216,  402,  403,  217,  82,   218,  404,  89,
+    405,  406,  90,   219,  407,  408,  409,  220,  91,   410,
+    221,  411,  223,  222,  224,  412,  225,  226,  413,  92,
+    414,  106,  93,   227,  94,   228,  83,   230,  95,   229,
+    415,  416,  417,  231,  97,   96,   418,  232,  98,   108,
+    84,   107,  99,   109,  87,   110,  100,  85,   101,  86,
+    111,  102,  419,  103,  420,  112,  421,  104,  423,  422,
+    233,  424,  105,  425,  426,  234,  427,  119,  237,  235,
+    236,  120,  126,  238,  113,  121,  239,  240,  241,  428,
+    127,  242,  128,  243,  114,  122,  247,  429,  430,  244,
+    245,  435,  248,  431,  432,  246,  433,  434,  436,  249,
+    115,  437,  116,  123,  117,  124,  118,  250,  125,  251,
+    252,  129,  438,  130,  131,  132,  133,  135,  134,  652,
+    651,  653,  439,  654,  551,  552,  559,  655,  656,  657,
+    658,  662,  442,  440,  663,  659,  443,  660,  560,  561,
+    661,  441,  664,  445,  666,  556,  444,  553,  554,  665,
+    557,  555,  558,  667,  668,  669,  670,  446,  671,  672,
+    448,  447,  452,  450,  453,  454,  449,  455,  456,  457,
+    451,  674,  673,  676,  677,  459,  675,  460,  678,  565,
+    458,  461,  562,  462,  563,  463,  464,  680,  679,  465,
+    467,  466,  468,  469,  476,  470,  471,  477,  478,  475,
+    479,  472,  480,  473,  681,  481,  474,  564,  682,  482,
+    483,  484,  683,  485,  486,  684,  491,  685,  487,  488,
+    489,  490,  686,  494,  687,  492,  493,  566,  567,  495,
+    496,  688,  689,  497,  690,  691,  692,  693,  694,  695,
+    696,  498,  499,  700,  502,  503,  697,  504,  500,  505,
+    701,  698,  506,  507,  508,  699,  501,  509,  702,  510,
+    511,  568,  703,  512,  704,  513,  705,  706,  569,  707,
+    708,  709,  571,  710,  570,  572,  573,  574,  575,  711,
+    712,  576,  714,  713,  715,  716,  577,  717,  718,  719,
+    586,  578,  587,  720,  579,  580,  515,  514,  721,  588,
+    589,  593,  590,  591,  581,  592,  516,  722,  594,  596,
+    595,  723,  724,  598,  517,  725,  597,  518,  519,  520,
+    726,  521,  522,  523,  727,  599,  582,  728,  524,  729,
+    600,  730,  731,  583,  601,  584,  735,  736,  733,  602,
+    732,  585,  734,  525,  526,  606,  603,  604,  737,  605,
+    738,  610,  616,  527,  739,  528,  529,  740,  611,  530,
+    531,  532,  742,  533,  741,  743,  534,  535,  744,  536,
+    537,  607,  538,  612,  745,  746,  539,  613,  747,  749,
+    748,  617,  618,  614,  608,  619,  609,  750,  540,  615,
+    541,  542,  751,  620,  622,  621,  623,  752,  543,  544,
+    624,  625,  753,  545,  754,  546,  755,  547,  756,  548,
+    626,  628,  629,  630,  631,  627,  549,  632,  649,  650,
+    633,  634,  635,  636,  637,  638,  639,  550,  640,  641,
+    642,  643,  644,  645,  646,  647,  648,  833,  897,  757,
+    758,  834,  759,  835,  760,  761,  838,  898,  836,  837,
+    762,  768,  764,  763,  840,  841,  765,  766,  767,  769,
+    842,  839,  843,  844,  770,  845,  772,  771,  847,  773,
+    846,  848,  849,  850,  851,  899,  852,  900,  853,  901,
+    854,  855,  856,  857,  774,  775,  776,  778,  777,  858,
+    779,  781,  859,  782,  860,  783,  861,  784,  902,  780,
+    862,  863,  785,  864,  786,  865,  787,  788,  789,  790,
+    791,  792,  793,  903,  904,  905,  794,  795,  796,  797,
+    798,  799,  866,  914,  906,  867,  915,  916,  917,  800,
+    922,  801,  918,  919,  923,  920,  924,  921,  925,  926,
+    907,  927,  802,  868,  869,  928,  870,  871,  929,  930,
+    803,  872,  874,  908,  931,  873,  932,  804,  909,  910,
+    935,  875,  936,  937,  805,  876,  911,  878,  806,  807,
+    938,  879,  877,  912,  880,  939,  934,  913,  933,  940,
+    881,  883,  941,  808,  943,  944,  942,  945,  882,  809,
+    810,  811,  812,  813,  814,  815,  816,  817,  818,  819,
+    820,  821,  947,  822,  948,  946,  823,  824,  949,  825,
+    884,  826,  950,  827,  885,  828,  829,  830,  831,  887,
+    886,  889,  890,  888,  951,  891,  895,  892,  893,  894,
+    896,  832,  992,  993,  952,  994,  995,  996,  953,  997,
+    972,  999,  998,  954,  1001, 1000, 1006, 1002, 1004, 1003,
+    1005, 1007, 1010, 1008, 1009, 955,  1011, 1013, 1012, 956,
+    957,  1014, 1015, 1016, 973,  974,  1017, 1018, 1019, 1020,
+    1021, 958,  1023, 1024, 1022, 1025, 1026, 1027, 975,  1029,
+    1028, 976,  959,  1033, 1031, 977,  1030, 1032, 978,  1034,
+    979,  1035, 1036, 1037, 1038, 980,  981,  1039, 1040, 1041,
+    982,  1043, 1042, 983,  984,  985,  1045, 986,  1044, 1046,
+    987,  960,  1050, 1047, 1051, 1048, 1049, 988,  989,  1052,
+    961,  962,  990,  1053, 1054, 1055, 991,  1057, 1059, 1058,
+    963,  1056, 964,  1060, 1061, 965,  966,  1062, 1063, 1065,
+    1064, 968,  969,  970,  967,  971,  1066, 1067, 1068, 1222,
+    1069, 1223, 1215, 1072, 1070, 1073, 1074, 1071, 1173, 1214,
+    1076, 1216, 1217, 1075, 1078, 1079, 1174, 1080, 1081, 1077,
+    1082, 1083, 1086, 1085, 1218, 1219, 1087, 1088, 1091, 1084,
+    1089, 1175, 1092, 1090, 1176, 1093, 1177, 1094, 1220, 1095,
+    1096, 1178, 1221, 1224, 1097, 1098, 1179, 1100, 1099, 1101,
+    1105, 1181, 1102, 1180, 1103, 1104, 1226, 1106, 1182, 1227,
+    1107, 1228, 1183, 1184, 1185, 1108, 1109, 1110, 1111, 1225,
+    1113, 1112, 1114, 1118, 1115, 1186, 1116, 1119, 1117, 1188,
+    1187, 1189, 1120, 1229, 1192, 1121, 1191, 1190, 1193, 1194,
+    1195, 1122, 1123, 1196, 1230, 1124, 1125, 1127, 1126, 1128,
+    1129, 1130, 1131, 1133, 1134, 1132, 1135, 1136, 1137, 1138,
+    1231, 1232, 1233, 1234, 1236, 1139, 1197, 1237, 1140, 1141,
+    1238, 1198, 1235, 1239, 1240, 1142, 1200, 1143, 1199, 1144,
+    1145, 1148, 1146, 1147, 1149, 1150, 1203, 1201, 1151, 1152,
+    1202, 1204, 1158, 1205, 1208, 1207, 1159, 1153, 1206, 1154,
+    1155, 1156, 1157, 1209, 1248, 1247, 1246, 1249, 1250, 1241,
+    1242, 1251, 1252, 1253, 1243, 1254, 1244, 1245, 1255, 1160,
+    1261, 1210, 1161, 1262, 1263, 1256, 1162, 1163, 1211, 1164,
+    1165, 1167, 1166, 1212, 1168, 1213, 1257, 1258, 1260, 1259,
+    1169, 1264, 1265, 1268, 1170, 1267, 1171, 1172, 1266, 1409,
+    1410, 1411, 1412, 1536, 1537, 1538, 1269, 1539, 1517, 1413,
+    1520, 1270, 1518, 1414, 1540, 1519, 1271, 1543, 1541, 1415,
+    1521, 1416, 1542, 1272, 1417, 1544, 1273, 1522, 1418, 1274,
+    1524, 1523, 1525, 1526, 1420, 1527, 1529, 1275, 1276, 1421,
+    1277, 1422, 1419, 1528, 1545, 1278, 1546, 1280, 1547, 1424,
+    1548, 1281, 1279, 1423, 1549, 1282, 1285, 1283, 1550, 1284,
+    1532, 1286, 1292, 1425, 1534, 1427, 1287, 1288, 1426, 1530,
+    1531, 1533, 1291, 1289, 1290, 1428, 1535, 1293, 1429, 1551,
+    1294, 1435, 1436, 1433, 1430, 1437, 1431, 1555, 1438, 1295,
+    1296, 1552, 1297, 1556, 1432, 1553, 1554, 1434, 1557, 1558,
+    1439, 1559, 1560, 1441, 1442, 1440, 1443, 1444, 1561, 1445,
+    1446, 1448, 1449, 1447, 1562, 1298, 1450, 1563, 1451, 1299,
+    1301, 1452, 1300, 1456, 1453, 1457, 1564, 1454, 1565, 1455,
+    1566, 1459, 1302, 1458, 1567, 1460, 1465, 1461, 1304, 1466,
+    1568, 1467, 1462, 1305, 1463, 1468, 1303, 1570, 1306, 1469,
+    1569, 1464, 1470, 1307, 1475, 1573, 1476, 1471, 1474, 1472,
+    1571, 1572, 1473, 1477, 1479, 1480, 1481, 1574, 1575, 1482,
+    1598, 1597, 1576, 1313, 1312, 1577, 1314, 1315, 1483, 1578,
+    1599, 1484, 1600, 1485, 1579, 1580, 1316, 1581, 1317, 1582,
+    1487, 1486, 1601, 1602, 1583, 1584, 1585, 1603, 1318, 1604,
+    1605, 1319, 1606, 1609, 1586, 1587, 1488, 1610, 1607, 1320,
+    1308, 1321, 1588, 1589, 1608, 1590, 1489, 1592, 1591, 1309,
+    1310, 1322, 1611, 1593, 1491, 1490, 1612, 1594, 1323, 1324,
+    1493, 1595, 1494, 1492, 1613, 1596, 1614, 1615, 1311, 1478,
+    1325, 1623, 1326, 1624, 1327, 1328, 1329, 1616, 1330, 1331,
+    1332, 1625, 1626, 1617, 1618, 1627, 1628, 1629, 1619, 1620,
+    1630, 1621, 1631, 1632, 1633, 1333, 1334, 1622, 1335, 1634,
+    1646, 1640, 1495, 1647, 1648, 1641, 1499, 1635, 1497, 1642,
+    1645, 1496, 1636, 1498, 1649, 1336, 1337, 1650, 1643, 1637,
+    1338, 1339, 1651, 1340, 1652, 1341, 1653, 1655, 1654, 1500,
+    1342, 1501, 1656, 1657, 1344, 1638, 1502, 1503, 1658, 1639,
+    1343, 1644, 1504, 1347, 1348, 1659, 1349, 1660, 1346, 1345,
+    1505, 1350, 1352, 1506, 1661, 1507, 1662, 1663, 1664, 1508,
+    1351, 1665, 1509, 1353, 1354, 1666, 1355, 1356, 1667, 1668,
+    1669, 1671, 1670, 1672, 1358, 1357, 1673, 1674, 1359, 1360,
+    1362, 1361, 1363, 1676, 1364, 1677, 1675, 1678, 1679, 1365,
+    1367, 1366, 1680, 1368, 1369, 1370, 1681, 1372, 1371, 1374,
+    1373, 1682, 1375, 1376, 1378, 1684, 1377, 1683, 1379, 1380,
+    1685, 1686, 1382, 1381, 1383, 1687, 1688, 1689, 1691, 1692,
+    1693, 1690, 1510, 1730, 1694, 1696, 1695, 1731, 1697, 1698,
+    1727, 1384, 1401, 1700, 1728, 1699, 1402, 1701, 1403, 1702,
+    1703, 1729, 1704, 1511, 1732, 1733, 1385, 1705, 1706, 1707,
+    1708, 1404, 1512, 1405, 1709, 1734, 1735, 1710, 1711, 1406,
+    1736, 1407, 1513, 1386, 1387, 1388, 1514, 1738, 1390, 1712,
+    1713, 1714, 1737, 1715, 1739, 1740, 1389, 1716, 1408, 1717,
+    1515, 1393, 1516, 1718, 1744, 1745, 1719, 1741, 1397, 1746,
+    1391, 1720, 1394, 1721, 1396, 1750, 1743, 1742, 1395, 1748,
+    1747, 1392, 1751, 1749, 1722, 1398, 1724, 1723, 1725, 1726,
+    1399, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760,
+    1761, 1763, 1762, 1764, 1400, 1766, 1765, 1923, 1767, 1768,
+    1924, 1769, 1770, 1925, 1771, 1926, 1772, 1927, 1928, 1929,
+    1930, 1773, 1774, 1775, 1932, 1776, 1931, 1933, 1777, 1934,
+    1778, 1779, 1780, 1781, 1935, 1782, 1936, 1783, 1784, 1937,
+    1785, 1786, 1939, 1938, 1940, 1941, 1787, 1944, 1942, 1788,
+    1943, 1945, 1789, 1946, 1948, 1805, 1790, 1947, 1791, 1949,
+    1806, 1950, 1793, 1792, 1794, 1795, 1796, 1951, 1807, 1797,
+    1798, 1952, 1808, 1888, 1809, 1810, 1954, 1953, 1799, 1811,
+    1812, 1957, 1800, 1813, 1958, 1801, 1802, 1814, 1959, 1956,
+    1955, 1960, 1961, 1815, 1803, 1804, 1817, 1962, 1890, 1892,
+    1893, 1889, 1816, 1891, 1820, 1896, 1818, 1819, 1894, 1895,
+    1897, 1963, 1898, 1964, 1899, 1821, 1822, 1900, 1901, 1902,
+    1965, 1823, 1904, 1903, 1966, 1824, 1826, 1828, 1827, 1829,
+    1825, 1830, 1831, 1834, 1832, 1835, 1837, 1833, 1836, 1838,
+    1967, 1907, 1905, 1839, 1906, 1843, 1968, 1840, 1841, 1842,
+    1844, 1914, 1845, 1846, 1916, 1847, 1848, 1849, 1850, 1851,
+    1852, 1853, 1917, 1854, 1908, 1855, 1918, 1919, 1920, 1856,
+    1858, 1857, 1859, 1915, 1860, 1861, 1910, 1862, 1909, 1911,
+    1863, 1864, 1912, 1913, 1865, 1921, 1866, 1867, 1868, 1869,
+    1870, 1871, 1872, 1922, 1873, 1875, 1874, 1876, 1877, 1878,
+    1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1969,
+    1970, 1971, 1972, 1973, 1974, 1975, 2038, 1976, 1979, 1977,
+    1980, 1978, 1981, 1983, 1982, 1984, 1990, 1985, 1987, 2039,
+    2044, 1988, 1986, 1989, 1991, 1992, 1993, 1994, 2040, 2045,
+    1995, 1996, 1997, 1998, 1999, 2005, 2007, 2000, 2001, 2002,
+    2006, 2003, 2004, 2008, 2009, 2010, 2012, 2011, 2013, 2014,
+    2015, 2016, 2017, 2019, 2018, 2020, 2021, 2022, 2047, 2023,
+    2025, 2046, 2024, 2026, 2027, 2028, 2029, 2030, 2031, 2041,
+    2042, 2043, 2032, 2033, 2034, 2035, 2036, 2037,
+};
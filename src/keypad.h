@@ -0,0 +1,13 @@
+#ifndef KEYPAD_H
+#define KEYPAD_H
+
+#include <stdint.h>
+#include "arduino-support.h"
+
+// The word list sorted by the keypad digits that spell each word. Each key
+// holds one digit per nibble, most significant first, with 1-8 standing for
+// keys 2-9 and 0 padding words shorter than eight letters.
+extern const uint32_t bip39_keypad_keys[] PROGMEM;
+extern const uint16_t bip39_keypad_words[] PROGMEM;
+
+#endif /* KEYPAD_H */
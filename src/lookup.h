@@ -0,0 +1,17 @@
+#ifndef LOOKUP_H
+#define LOOKUP_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// Looks a word up through the prefix tables. Much faster than the
+// constant-time scan, but its timing depends on the word; used where
+// throughput matters more, and on AVR, where it is the only lookup.
+int16_t bip39_table_word_from_mnemonic_len(const char* mnemonic, size_t mnemonic_len);
+
+// Writes word `i` (which must be < 2048) and its terminator to `b`, which
+// holds at least 9 bytes. Unlike `bip39_mnemonic_from_word` it needs no
+// context, so it is safe for hot loops and concurrent callers.
+void bip39_load_mnemonic(uint16_t i, char* b);
+
+#endif /* LOOKUP_H */
@@ -0,0 +1,425 @@
+#ifndef ARDUINO
+
+#include "bip39.h"
+#include "kernels.h"
+
+#include <pthread.h>
+#include <string.h>
+
+#include <bc-crypto-base/bc-crypto-base.h>
+
+// Recovers the order of a phrase whose words are known. Candidate orders
+// are built one position at a time into a packed bit buffer, so moving to a
+// sibling rewrites only the 11 bits of the position that changed, and each
+// complete order costs a single SHA-256 block to check its checksum.
+//
+// The search is split into units, each fixing the words at the first few
+// free positions (in lexicographic order of the distinct words), and
+// threads take units in turn. Units finish out of order; the progress
+// callback is given the number of leading units that have all finished,
+// which is where a later search can resume.
+
+#define MAX_WORDS 24
+#define MAX_THREADS 64
+#define UNIT_DEPTH 3
+// 24 words of 11 bits, plus the byte `put_word` touches past the last.
+#define BITS_LEN 34
+
+typedef struct search_t {
+    const bip39_kernel* kernel;
+    size_t words_len;
+    uint16_t fixed[MAX_WORDS];
+    size_t free_positions[MAX_WORDS];
+    size_t free_len;
+
+    // The words left for the free positions, as distinct values and counts.
+    uint16_t values[MAX_WORDS];
+    uint8_t counts[MAX_WORDS];
+    size_t values_len;
+
+    uint8_t* units;
+    size_t unit_depth;
+    uint64_t units_len;
+
+    pthread_mutex_t mutex;
+    uint64_t next_unit;
+    uint64_t resume_unit;
+    bool* done;
+    // Read without the mutex by workers deep in fill(); always accessed
+    // through is_stopped() and stop().
+    bool stopped;
+
+    bip39_order_callback found;
+    bip39_order_progress progress;
+    void* user_data;
+} search;
+
+typedef struct worker_t {
+    search* s;
+    uint8_t bits[BITS_LEN];
+    uint16_t words[MAX_WORDS];
+    uint8_t counts[MAX_WORDS];
+} worker;
+
+static void put_word(uint8_t* bits, size_t position, uint16_t word) {
+    size_t offset = position * 11;
+    size_t byte = offset / 8;
+    unsigned shift = 24 - 11 - offset % 8;
+    uint32_t mask = 0x7FFUL << shift;
+    uint32_t v = (uint32_t)bits[byte] << 16 | (uint32_t)bits[byte + 1] << 8 | bits[byte + 2];
+    v = (v & ~mask) | (uint32_t)word << shift;
+    bits[byte] = v >> 16;
+    bits[byte + 1] = v >> 8;
+    bits[byte + 2] = v;
+}
+
+static bool checksum_matches(const bip39_kernel* kernel, const uint8_t* bits) {
+    uint8_t hash[SHA256_DIGEST_LENGTH];
+    size_t checksum_bits = kernel->words_len / 3;
+    sha256_Raw(bits, kernel->secret_len, hash);
+    bool match = ((hash[0] ^ bits[kernel->secret_len]) >> (8 - checksum_bits)) == 0;
+    memzero(hash, sizeof(hash));
+    return match;
+}
+
+// Sets up the fixed positions and the words left for the rest. Returns
+// false if a fixed word is not among the words.
+static bool prepare(search* s, const uint16_t* words, size_t words_len, const uint16_t* fixed) {
+    memset(s, 0, sizeof(search));
+    s->kernel = bip39_kernel_for_words_len(words_len);
+    if (s->kernel == NULL) {
+        return false;
+    }
+    s->words_len = words_len;
+
+    uint16_t left[MAX_WORDS];
+    size_t left_len = words_len;
+    for (size_t i = 0; i < words_len; i++) {
+        if (words[i] > 2047) {
+            return false;
+        }
+        left[i] = words[i];
+    }
+    for (size_t p = 0; p < words_len; p++) {
+        s->fixed[p] = fixed == NULL ? BIP39_ORDER_ANY : fixed[p];
+        if (s->fixed[p] == BIP39_ORDER_ANY) {
+            s->free_positions[s->free_len++] = p;
+            continue;
+        }
+        size_t i = 0;
+        while (i < left_len && left[i] != s->fixed[p]) {
+            i++;
+        }
+        if (i == left_len) {
+            return false;
+        }
+        left[i] = left[--left_len];
+    }
+
+    // Sorted distinct values, so units and orders are enumerated in a
+    // fixed order that resuming can rely on.
+    for (size_t i = 1; i < left_len; i++) {
+        uint16_t w = left[i];
+        size_t j = i;
+        while (j > 0 && left[j - 1] > w) {
+            left[j] = left[j - 1];
+            j--;
+        }
+        left[j] = w;
+    }
+    for (size_t i = 0; i < left_len; i++) {
+        if (s->values_len > 0 && s->values[s->values_len - 1] == left[i]) {
+            s->counts[s->values_len - 1]++;
+        } else {
+            s->values[s->values_len] = left[i];
+            s->counts[s->values_len] = 1;
+            s->values_len++;
+        }
+    }
+    return true;
+}
+
+// Appends every assignment of distinct values to the first `unit_depth`
+// free positions to `s->units`, or just counts them if `s->units` is NULL.
+static void enumerate_units(search* s, uint8_t* counts, uint8_t* prefix, size_t depth) {
+    if (depth == s->unit_depth) {
+        if (s->units != NULL) {
+            memcpy(s->units + s->units_len * s->unit_depth, prefix, s->unit_depth);
+        }
+        s->units_len++;
+        return;
+    }
+    for (size_t v = 0; v < s->values_len; v++) {
+        if (counts[v] > 0) {
+            counts[v]--;
+            prefix[depth] = v;
+            enumerate_units(s, counts, prefix, depth + 1);
+            counts[v]++;
+        }
+    }
+}
+
+static void count_units(search* s) {
+    uint8_t counts[MAX_WORDS];
+    uint8_t prefix[UNIT_DEPTH];
+    s->unit_depth = s->free_len < UNIT_DEPTH ? s->free_len : UNIT_DEPTH;
+    memcpy(counts, s->counts, sizeof(counts));
+    s->units = NULL;
+    s->units_len = 0;
+    enumerate_units(s, counts, prefix, 0);
+}
+
+// Returns false if the units could not be allocated.
+static bool make_units(search* s) {
+    uint8_t counts[MAX_WORDS];
+    uint8_t prefix[UNIT_DEPTH];
+    count_units(s);
+    s->units = malloc(s->units_len * s->unit_depth + 1);
+    if (s->units == NULL) {
+        return false;
+    }
+    memcpy(counts, s->counts, sizeof(counts));
+    s->units_len = 0;
+    enumerate_units(s, counts, prefix, 0);
+    return true;
+}
+
+static bool is_stopped(search* s) {
+    return __atomic_load_n(&s->stopped, __ATOMIC_ACQUIRE);
+}
+
+static void stop(search* s) {
+    __atomic_store_n(&s->stopped, true, __ATOMIC_RELEASE);
+}
+
+// Fills free positions from `depth` on. Returns false if the search was
+// stopped.
+static bool fill(worker* w, size_t depth) {
+    search* s = w->s;
+    if (depth == s->free_len) {
+        if (checksum_matches(s->kernel, w->bits)) {
+            pthread_mutex_lock(&s->mutex);
+            if (!is_stopped(s) && s->found(w->words, s->words_len, s->user_data)) {
+                stop(s);
+            }
+            pthread_mutex_unlock(&s->mutex);
+        }
+        return !is_stopped(s);
+    }
+    size_t position = s->free_positions[depth];
+    for (size_t v = 0; v < s->values_len; v++) {
+        if (w->counts[v] > 0) {
+            w->counts[v]--;
+            w->words[position] = s->values[v];
+            put_word(w->bits, position, s->values[v]);
+            bool more = fill(w, depth + 1);
+            w->counts[v]++;
+            if (!more) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool run_unit(worker* w, uint64_t unit) {
+    search* s = w->s;
+    const uint8_t* prefix = s->units + unit * s->unit_depth;
+    memcpy(w->counts, s->counts, sizeof(w->counts));
+    for (size_t d = 0; d < s->unit_depth; d++) {
+        size_t position = s->free_positions[d];
+        w->counts[prefix[d]]--;
+        w->words[position] = s->values[prefix[d]];
+        put_word(w->bits, position, s->values[prefix[d]]);
+    }
+    return fill(w, s->unit_depth);
+}
+
+static void* run_worker(void* arg) {
+    worker* w = arg;
+    search* s = w->s;
+    memset(w->bits, 0, sizeof(w->bits));
+    for (size_t p = 0; p < s->words_len; p++) {
+        if (s->fixed[p] != BIP39_ORDER_ANY) {
+            w->words[p] = s->fixed[p];
+            put_word(w->bits, p, s->fixed[p]);
+        }
+    }
+    while (true) {
+        pthread_mutex_lock(&s->mutex);
+        uint64_t unit = s->next_unit++;
+        bool stopped = is_stopped(s) || unit >= s->units_len;
+        pthread_mutex_unlock(&s->mutex);
+        if (stopped || !run_unit(w, unit)) {
+            break;
+        }
+
+        pthread_mutex_lock(&s->mutex);
+        s->done[unit] = true;
+        while (s->resume_unit < s->units_len && s->done[s->resume_unit]) {
+            s->resume_unit++;
+        }
+        if (!is_stopped(s) && s->progress != NULL && !s->progress(s->resume_unit, s->units_len, s->user_data)) {
+            stop(s);
+        }
+        pthread_mutex_unlock(&s->mutex);
+    }
+    memzero(w->bits, sizeof(w->bits));
+    memzero(w->words, sizeof(w->words));
+    return NULL;
+}
+
+uint64_t bip39_order_units(const uint16_t* words, size_t words_len, const uint16_t* fixed) {
+    search s;
+    if (!prepare(&s, words, words_len, fixed)) {
+        return 0;
+    }
+    count_units(&s);
+    return s.units_len;
+}
+
+uint64_t bip39_recover_order(const uint16_t* words, size_t words_len, const uint16_t* fixed, size_t threads, uint64_t first_unit, bip39_order_callback found, bip39_order_progress progress, void* user_data) {
+    search* s = malloc(sizeof(search));
+    if (s == NULL) {
+        return BIP39_ORDER_FAILED;
+    }
+    if (!prepare(s, words, words_len, fixed)) {
+        free(s);
+        return 0;
+    }
+    if (threads == 0) {
+        threads = 1;
+    } else if (threads > MAX_THREADS) {
+        threads = MAX_THREADS;
+    }
+    bool made = make_units(s);
+    s->done = made ? calloc(s->units_len, sizeof(bool)) : NULL;
+    worker* workers = malloc(threads * sizeof(worker));
+    if (s->done == NULL || workers == NULL) {
+        free(workers);
+        free(s->done);
+        free(s->units);
+        memzero(s, sizeof(search));
+        free(s);
+        return BIP39_ORDER_FAILED;
+    }
+    s->found = found;
+    s->progress = progress;
+    s->user_data = user_data;
+    s->next_unit = s->resume_unit = first_unit < s->units_len ? first_unit : s->units_len;
+    pthread_mutex_init(&s->mutex, NULL);
+
+    pthread_t ids[MAX_THREADS];
+    bool started[MAX_THREADS];
+    for (size_t t = 0; t < threads; t++) {
+        workers[t].s = s;
+        started[t] = t > 0 && pthread_create(&ids[t], NULL, run_worker, &workers[t]) == 0;
+    }
+    // Units are taken from a shared counter, so the calling thread's
+    // worker picks up whatever a thread that failed to start would have.
+    run_worker(&workers[0]);
+    for (size_t t = 1; t < threads; t++) {
+        if (started[t]) {
+            pthread_join(ids[t], NULL);
+        }
+    }
+
+    uint64_t resume_unit = s->resume_unit;
+    pthread_mutex_destroy(&s->mutex);
+    free(workers);
+    free(s->done);
+    free(s->units);
+    memzero(s, sizeof(search));
+    free(s);
+    return resume_unit;
+}
+
+// Layouts. Words written on a grid may have been read back by rows when
+// they were written by columns, from the wrong corner, or alternating
+// direction row by row. Each traversal is a permutation of the positions.
+
+static void layout_order(size_t rows, size_t cols, unsigned variant, uint8_t* order) {
+    bool by_columns = variant & 1;
+    bool flip_rows = variant & 2;
+    bool flip_cols = variant & 4;
+    bool snake = variant & 8;
+    size_t major = by_columns ? cols : rows;
+    size_t minor = by_columns ? rows : cols;
+    size_t k = 0;
+    for (size_t i = 0; i < major; i++) {
+        for (size_t j0 = 0; j0 < minor; j0++) {
+            size_t j = snake && i % 2 == 1 ? minor - 1 - j0 : j0;
+            size_t r = by_columns ? j : i;
+            size_t c = by_columns ? i : j;
+            if (flip_rows) {
+                r = rows - 1 - r;
+            }
+            if (flip_cols) {
+                c = cols - 1 - c;
+            }
+            order[k++] = (uint8_t)(r * cols + c);
+        }
+    }
+}
+
+// True if a traversal visited before this one produces the same order.
+// Earlier orders are regenerated rather than stored, which keeps the
+// frame small; at 24 words that is at most 128 traversals of 24 words.
+static bool seen_before(size_t words_len, size_t rows, unsigned variant, const uint8_t* order) {
+    uint8_t earlier[MAX_WORDS];
+    for (size_t r = 1; r <= rows; r++) {
+        if (words_len % r != 0) {
+            continue;
+        }
+        unsigned variants = r == rows ? variant : 16;
+        for (unsigned v = 0; v < variants; v++) {
+            layout_order(r, words_len / r, v, earlier);
+            if (memcmp(earlier, order, words_len) == 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+size_t bip39_recover_layout(const uint16_t* words, size_t words_len, const uint16_t* fixed, bip39_order_callback found, void* user_data) {
+    const bip39_kernel* kernel = bip39_kernel_for_words_len(words_len);
+    if (kernel == NULL) {
+        return 0;
+    }
+    uint8_t order[MAX_WORDS];
+    size_t reported = 0;
+    bool stopped = false;
+    uint8_t bits[BITS_LEN];
+    uint16_t candidate[MAX_WORDS];
+
+    for (size_t rows = 1; rows <= words_len && !stopped; rows++) {
+        if (words_len % rows != 0) {
+            continue;
+        }
+        size_t cols = words_len / rows;
+        for (unsigned variant = 0; variant < 16 && !stopped; variant++) {
+            layout_order(rows, cols, variant, order);
+            if (seen_before(words_len, rows, variant, order)) {
+                continue;
+            }
+
+            bool allowed = true;
+            memset(bits, 0, sizeof(bits));
+            for (size_t p = 0; p < words_len; p++) {
+                candidate[p] = words[order[p]];
+                allowed = allowed && candidate[p] <= 2047 && (fixed == NULL || fixed[p] == BIP39_ORDER_ANY || fixed[p] == candidate[p]);
+                put_word(bits, p, candidate[p]);
+            }
+            if (allowed && checksum_matches(kernel, bits)) {
+                reported++;
+                stopped = found(candidate, words_len, user_data);
+            }
+        }
+    }
+    memzero(bits, sizeof(bits));
+    memzero(candidate, sizeof(candidate));
+    return reported;
+}
+
+#endif /* ARDUINO */
@@ -0,0 +1,400 @@
+#include "bip39.h"
+#include "kernels.h"
+#include "lookup.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include "bc-crypto-base.h"
+#else
+#include <bc-crypto-base/bc-crypto-base.h>
+#endif
+
+#if !defined(ARDUINO) && !defined(__AVR__)
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#if defined(__SSE2__) && !defined(ARDUINO)
+#include <emmintrin.h>
+#endif
+
+// Finds BIP39 phrases in arbitrary bytes. Letters are folded to lower case
+// and split into tokens; consecutive dictionary words form a run as long as
+// they are separated by at most SCAN_MAX_GAP non-letter bytes (enough for
+// spaces, newlines, list numbering or JSON punctuation). Any other token
+// ends the run. Within a run, the earliest starting phrase is reported
+// first, preferring the longest length whose checksum is valid.
+//
+// Input is classified 64 bytes at a time into a letter mask (with SSE2
+// where available), and tokens are taken from the mask's edges, so the
+// per-byte work is a compare and a shift. On hosts, tokens are then looked
+// up in a hash table compiled from the word list when the scanner is
+// created: each word, NUL-padded to eight bytes, is one 64-bit key, so a
+// lookup is a multiply and one or two probes. AVR builds use the prefix
+// tables instead.
+
+#define SCAN_MAX_WORDS 24
+#define SCAN_MIN_WORDS 12
+#define SCAN_MAX_GAP 8
+#define SCAN_MIN_TOKEN 3
+#define SCAN_MAX_TOKEN 8
+#define SCAN_BLOCK_LEN 64
+#define SCAN_TABLE_BITS 12
+#define SCAN_TABLE_LEN (1 << SCAN_TABLE_BITS)
+
+typedef struct scanner_t {
+    bip39_scan_callback callback;
+    void* user_data;
+
+    size_t offset;
+
+    // A token still open at the end of the last chunk.
+    char token[SCAN_MAX_TOKEN];
+    uint8_t token_len;
+    bool in_token;
+    size_t token_start;
+
+    uint16_t words[SCAN_MAX_WORDS];
+    size_t word_starts[SCAN_MAX_WORDS];
+    size_t word_ends[SCAN_MAX_WORDS];
+    uint8_t words_len;
+
+#if !defined(ARDUINO) && !defined(__AVR__)
+    // Open addressing, half full; empty keys are 0.
+    uint64_t keys[SCAN_TABLE_LEN];
+    uint16_t table_words[SCAN_TABLE_LEN];
+#endif
+} scanner;
+
+#if !defined(ARDUINO) && !defined(__AVR__)
+static size_t table_slot(uint64_t key) {
+    return (key * 0x9E3779B97F4A7C15ULL) >> (64 - SCAN_TABLE_BITS);
+}
+#endif
+
+void* bip39_new_scanner(bip39_scan_callback callback, void* user_data) {
+    scanner* s = calloc(sizeof(scanner), 1);
+    if (s == NULL) {
+        return NULL;
+    }
+    s->callback = callback;
+    s->user_data = user_data;
+#if !defined(ARDUINO) && !defined(__AVR__)
+    for (uint16_t w = 0; w < 2048; w++) {
+        char word[9] = { 0 };
+        bip39_load_mnemonic(w, word);
+        uint64_t key;
+        memcpy(&key, word, sizeof(key));
+        size_t i = table_slot(key);
+        while (s->keys[i] != 0) {
+            i = (i + 1) & (SCAN_TABLE_LEN - 1);
+        }
+        s->keys[i] = key;
+        s->table_words[i] = w;
+    }
+#endif
+    return s;
+}
+
+void bip39_dispose_scanner(void* scn) {
+    scanner* s = scn;
+    memzero(s, sizeof(scanner));
+    free(s);
+}
+
+static bool checksum_is_valid(scanner* s, uint8_t words_len) {
+    uint8_t secret[32];
+    bool result = bip39_kernel_for_words_len(words_len)->decode(s->words, secret);
+    memzero(secret, sizeof(secret));
+    return result;
+}
+
+static void drop_words(scanner* s, uint8_t count) {
+    s->words_len -= count;
+    memmove(s->words, s->words + count, s->words_len * sizeof(uint16_t));
+    memmove(s->word_starts, s->word_starts + count, s->words_len * sizeof(size_t));
+    memmove(s->word_ends, s->word_ends + count, s->words_len * sizeof(size_t));
+}
+
+// Decides the phrase (if any) that starts at the first buffered word, then
+// drops the words that can no longer start a phrase.
+static void scan_front(scanner* s) {
+    for (uint8_t len = SCAN_MAX_WORDS; len >= SCAN_MIN_WORDS; len -= 3) {
+        if (len <= s->words_len && checksum_is_valid(s, len)) {
+            size_t start = s->word_starts[0];
+            size_t length = s->word_ends[len - 1] - start;
+            s->callback(start, length, s->words, len, s->user_data);
+            drop_words(s, len);
+            return;
+        }
+    }
+    drop_words(s, 1);
+}
+
+static void end_run(scanner* s) {
+    if (s->words_len == 0) {
+        return;
+    }
+    while (s->words_len >= SCAN_MIN_WORDS) {
+        scan_front(s);
+    }
+    memset(s->words, 0, sizeof(s->words));
+    s->words_len = 0;
+}
+
+// Looks up a token of SCAN_MIN_TOKEN to SCAN_MAX_TOKEN letters, in any case.
+static int16_t token_word(const scanner* s, const char* token, size_t len) {
+    char folded[SCAN_MAX_TOKEN] = { 0 };
+    for (size_t i = 0; i < len; i++) {
+        folded[i] = token[i] | 0x20;
+    }
+#if !defined(ARDUINO) && !defined(__AVR__)
+    uint64_t key;
+    memcpy(&key, folded, sizeof(key));
+    for (size_t i = table_slot(key); s->keys[i] != 0; i = (i + 1) & (SCAN_TABLE_LEN - 1)) {
+        if (s->keys[i] == key) {
+            return s->table_words[i];
+        }
+    }
+    return -1;
+#else
+    return bip39_table_word_from_mnemonic_len(folded, len);
+#endif
+}
+
+// Handles the token at stream offsets [start, end).
+static void end_token(scanner* s, size_t start, size_t end, const char* token) {
+    size_t len = end - start;
+    int16_t w = len >= SCAN_MIN_TOKEN && len <= SCAN_MAX_TOKEN ? token_word(s, token, len) : -1;
+    if (w < 0) {
+        end_run(s);
+        return;
+    }
+    if (s->words_len > 0 && start - s->word_ends[s->words_len - 1] > SCAN_MAX_GAP) {
+        end_run(s);
+    }
+    s->words[s->words_len] = w;
+    s->word_starts[s->words_len] = start;
+    s->word_ends[s->words_len] = end;
+    s->words_len++;
+    if (s->words_len == SCAN_MAX_WORDS) {
+        scan_front(s);
+    }
+}
+
+// Returns a mask with bit i set if bytes[i] is an ASCII letter. `len` is at
+// most SCAN_BLOCK_LEN.
+static uint64_t letter_mask(const uint8_t* bytes, size_t len) {
+#if defined(__SSE2__) && !defined(ARDUINO)
+    if (len == SCAN_BLOCK_LEN) {
+        const __m128i fold = _mm_set1_epi8(0x20);
+        const __m128i a = _mm_set1_epi8('a');
+        const __m128i last = _mm_set1_epi8(25);
+        uint64_t mask = 0;
+        for (size_t i = 0; i < SCAN_BLOCK_LEN; i += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i*)(bytes + i));
+            __m128i t = _mm_sub_epi8(_mm_or_si128(v, fold), a);
+            __m128i letter = _mm_cmpeq_epi8(_mm_min_epu8(t, last), t);
+            mask |= (uint64_t)(uint16_t)_mm_movemask_epi8(letter) << i;
+        }
+        return mask;
+    }
+#endif
+    uint64_t mask = 0;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t t = (bytes[i] | 0x20) - 'a';
+        mask |= (uint64_t)(t < 26) << i;
+    }
+    return mask;
+}
+
+static void append_token(scanner* s, const uint8_t* bytes, size_t len) {
+    for (size_t i = 0; i < len && s->token_len < SCAN_MAX_TOKEN; i++) {
+        s->token[s->token_len++] = bytes[i];
+    }
+}
+
+void bip39_scan(void* scn, const uint8_t* bytes, size_t length) {
+    scanner* s = scn;
+    size_t base = s->offset;
+    for (size_t b = 0; b < length; b += SCAN_BLOCK_LEN) {
+        size_t n = length - b < SCAN_BLOCK_LEN ? length - b : SCAN_BLOCK_LEN;
+        uint64_t letters = letter_mask(bytes + b, n);
+        uint64_t before = letters << 1 | (s->in_token ? 1 : 0);
+        uint64_t starts = letters & ~before;
+        uint64_t ends = ~letters & before;
+        if (n < SCAN_BLOCK_LEN) {
+            ends &= (1ULL << n) - 1;
+        }
+        // Starts and ends alternate, beginning with an end if a token is open.
+        for (;;) {
+            if (!s->in_token) {
+                if (starts == 0) {
+                    break;
+                }
+                s->in_token = true;
+                s->token_start = base + b + __builtin_ctzll(starts);
+                starts &= starts - 1;
+            } else {
+                if (ends == 0) {
+                    break;
+                }
+                size_t end = base + b + __builtin_ctzll(ends);
+                ends &= ends - 1;
+                s->in_token = false;
+                if (s->token_start >= base) {
+                    end_token(s, s->token_start, end, (const char*)bytes + (s->token_start - base));
+                } else {
+                    append_token(s, bytes, end - base);
+                    end_token(s, s->token_start, end, s->token);
+                    s->token_len = 0;
+                }
+            }
+        }
+    }
+    // Keep the first letters of a token that runs into the next chunk.
+    if (s->in_token && s->token_start >= base) {
+        s->token_len = 0;
+        append_token(s, bytes + (s->token_start - base), base + length - s->token_start);
+    } else if (s->in_token) {
+        append_token(s, bytes, length);
+    }
+    s->offset = base + length;
+}
+
+void bip39_finish_scan(void* scn) {
+    scanner* s = scn;
+    if (s->in_token) {
+        s->in_token = false;
+        end_token(s, s->token_start, s->offset, s->token);
+    }
+    end_run(s);
+    memset(s->token, 0, sizeof(s->token));
+    s->token_len = 0;
+    s->offset = 0;
+}
+
+#if !defined(ARDUINO) && !defined(__AVR__)
+
+// Files are read in blocks of this size, one buffer per thread.
+#define SCAN_READ_LEN (1024 * 1024)
+
+typedef struct file_scan_t {
+    const char* const* paths;
+    size_t paths_len;
+    bip39_scan_file_callback callback;
+    void* user_data;
+
+    pthread_mutex_t mutex;
+    size_t next_path;
+    size_t failed;
+} file_scan;
+
+typedef struct file_worker_t {
+    file_scan* scan;
+    size_t path;
+} file_worker;
+
+// Serializes one scanner's findings into the caller's callback.
+static void report_file_phrase(size_t offset, size_t length, const uint16_t* words, size_t words_len, void* user_data) {
+    file_worker* w = user_data;
+    pthread_mutex_lock(&w->scan->mutex);
+    w->scan->callback(w->path, offset, length, words, words_len, w->scan->user_data);
+    pthread_mutex_unlock(&w->scan->mutex);
+}
+
+static bool scan_file(void* scanner, const char* path, uint8_t* buf) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    bool ok = true;
+    for (;;) {
+        ssize_t n = read(fd, buf, SCAN_READ_LEN);
+        if (n > 0) {
+            bip39_scan(scanner, buf, n);
+        } else if (n == 0) {
+            break;
+        } else if (errno != EINTR) {
+            ok = false;
+            break;
+        }
+    }
+    close(fd);
+    bip39_finish_scan(scanner);
+    return ok;
+}
+
+static void* run_file_worker(void* arg) {
+    file_worker* w = arg;
+    file_scan* f = w->scan;
+    uint8_t* buf = malloc(SCAN_READ_LEN);
+    void* scanner = bip39_new_scanner(report_file_phrase, w);
+    for (;;) {
+        pthread_mutex_lock(&f->mutex);
+        size_t path = f->next_path++;
+        pthread_mutex_unlock(&f->mutex);
+        if (path >= f->paths_len) {
+            break;
+        }
+        w->path = path;
+        if (buf == NULL || scanner == NULL || !scan_file(scanner, f->paths[path], buf)) {
+            pthread_mutex_lock(&f->mutex);
+            f->failed++;
+            pthread_mutex_unlock(&f->mutex);
+        }
+    }
+    if (scanner != NULL) {
+        bip39_dispose_scanner(scanner);
+    }
+    if (buf != NULL) {
+        memzero(buf, SCAN_READ_LEN);
+        free(buf);
+    }
+    return NULL;
+}
+
+size_t bip39_scan_files(const char* const* paths, size_t paths_len, size_t threads, bip39_scan_file_callback callback, void* user_data) {
+    if (threads == 0) {
+        threads = 1;
+    }
+    if (threads > paths_len) {
+        threads = paths_len;
+    }
+    file_scan f = { paths, paths_len, callback, user_data };
+    pthread_mutex_init(&f.mutex, NULL);
+    file_worker* workers = calloc(threads, sizeof(file_worker));
+    pthread_t* ids = calloc(threads, sizeof(pthread_t));
+    if (paths_len > 0 && (workers == NULL || ids == NULL)) {
+        free(workers);
+        free(ids);
+        pthread_mutex_destroy(&f.mutex);
+        return paths_len;
+    }
+    // The calling thread is one of the workers.
+    size_t started = 1;
+    for (size_t i = 0; i < threads; i++) {
+        workers[i].scan = &f;
+    }
+    for (; started < threads; started++) {
+        if (pthread_create(&ids[started], NULL, run_file_worker, &workers[started]) != 0) {
+            break;
+        }
+    }
+    if (threads > 0) {
+        run_file_worker(&workers[0]);
+    }
+    for (size_t i = 1; i < started; i++) {
+        pthread_join(ids[i], NULL);
+    }
+    free(workers);
+    free(ids);
+    pthread_mutex_destroy(&f.mutex);
+    return f.failed;
+}
+
+#endif /* ARDUINO */
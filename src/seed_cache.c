@@ -0,0 +1,333 @@
+#ifndef ARDUINO
+
+#include "bip39.h"
+#include "arena.h"
+#include "entropy.h"
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include <bc-crypto-base/bc-crypto-base.h>
+
+// Entries are found by an HMAC-SHA256 tag of the phrase and passphrase, so
+// the cache never holds either. Seeds are stored XORed with an HMAC-SHA512
+// keystream over a per-entry counter; both keys are random per cache and
+// live in the locked arena. Entries sit on a hash chain for lookup, on a
+// doubly-linked list in recency order for eviction and on a second one in
+// expiry order for the TTL. Every entry lives for the same TTL from its
+// insertion, so appending keeps the expiry list sorted and expired entries
+// are always at its head, however recently they were used.
+
+#define NIL UINT32_MAX
+#define TAG_LEN SHA256_DIGEST_LENGTH
+#define KEY_LEN 32
+
+typedef struct entry_t {
+    uint8_t tag[TAG_LEN];
+    uint8_t sealed_seed[BIP39_MNEMONIC_SEED_LEN];
+    uint64_t nonce;
+    uint64_t expires;
+    uint32_t chain;
+    uint32_t newer;
+    uint32_t older;
+    uint32_t later;
+    uint32_t earlier;
+} entry;
+
+typedef struct keys_t {
+    uint8_t tag_key[KEY_LEN];
+    uint8_t seal_key[KEY_LEN];
+} keys;
+
+typedef struct seed_cache_t {
+    pthread_mutex_t mutex;
+    keys* keys;
+
+    entry* entries;
+    uint32_t max_entries;
+    uint32_t* buckets;
+    uint32_t buckets_mask;
+
+    uint32_t newest;
+    uint32_t oldest;
+    uint32_t first_expiring;
+    uint32_t last_expiring;
+    uint32_t free_entry;
+
+    uint64_t ttl_ns;
+    uint64_t next_nonce;
+
+    uint64_t hits;
+    uint64_t misses;
+} seed_cache;
+
+static uint64_t now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void compute_tag(const seed_cache* c, const char* mnemonics, const char* passphrase, uint8_t* tag) {
+    // The phrase length is hashed first so that moving bytes between the
+    // phrase and the passphrase gives a different tag.
+    uint32_t mnemonics_len = strlen(mnemonics);
+    uint8_t len_bytes[4] = { mnemonics_len >> 24, mnemonics_len >> 16, mnemonics_len >> 8, mnemonics_len };
+    HMAC_SHA256_CTX hctx;
+    hmac_sha256_Init(&hctx, c->keys->tag_key, KEY_LEN);
+    hmac_sha256_Update(&hctx, len_bytes, sizeof(len_bytes));
+    hmac_sha256_Update(&hctx, (const uint8_t*)mnemonics, mnemonics_len);
+    hmac_sha256_Update(&hctx, (const uint8_t*)passphrase, strlen(passphrase));
+    hmac_sha256_Final(&hctx, tag);
+    memzero(&hctx, sizeof(hctx));
+}
+
+// Sealing and unsealing are the same XOR.
+static void seal(const seed_cache* c, uint64_t nonce, const uint8_t* in, uint8_t* out) {
+    uint8_t nonce_bytes[8];
+    for (int i = 0; i < 8; i++) {
+        nonce_bytes[i] = nonce >> (56 - 8 * i);
+    }
+    uint8_t stream[SHA512_DIGEST_LENGTH];
+    hmac_sha512(c->keys->seal_key, KEY_LEN, nonce_bytes, sizeof(nonce_bytes), stream);
+    for (int i = 0; i < BIP39_MNEMONIC_SEED_LEN; i++) {
+        out[i] = in[i] ^ stream[i];
+    }
+    memzero(stream, sizeof(stream));
+}
+
+static uint32_t bucket_of(const seed_cache* c, const uint8_t* tag) {
+    // The tag is already a keyed hash.
+    uint32_t h = (uint32_t)tag[0] | (uint32_t)tag[1] << 8 | (uint32_t)tag[2] << 16 | (uint32_t)tag[3] << 24;
+    return h & c->buckets_mask;
+}
+
+static void unlink_recency(seed_cache* c, uint32_t i) {
+    entry* e = &c->entries[i];
+    if (e->newer == NIL) {
+        c->newest = e->older;
+    } else {
+        c->entries[e->newer].older = e->older;
+    }
+    if (e->older == NIL) {
+        c->oldest = e->newer;
+    } else {
+        c->entries[e->older].newer = e->newer;
+    }
+}
+
+static void make_newest(seed_cache* c, uint32_t i) {
+    entry* e = &c->entries[i];
+    e->newer = NIL;
+    e->older = c->newest;
+    if (c->newest != NIL) {
+        c->entries[c->newest].newer = i;
+    }
+    c->newest = i;
+    if (c->oldest == NIL) {
+        c->oldest = i;
+    }
+}
+
+static void unlink_expiry(seed_cache* c, uint32_t i) {
+    entry* e = &c->entries[i];
+    if (e->earlier == NIL) {
+        c->first_expiring = e->later;
+    } else {
+        c->entries[e->earlier].later = e->later;
+    }
+    if (e->later == NIL) {
+        c->last_expiring = e->earlier;
+    } else {
+        c->entries[e->later].earlier = e->earlier;
+    }
+}
+
+static void make_last_expiring(seed_cache* c, uint32_t i) {
+    entry* e = &c->entries[i];
+    e->later = NIL;
+    e->earlier = c->last_expiring;
+    if (c->last_expiring != NIL) {
+        c->entries[c->last_expiring].later = i;
+    }
+    c->last_expiring = i;
+    if (c->first_expiring == NIL) {
+        c->first_expiring = i;
+    }
+}
+
+static void remove_entry(seed_cache* c, uint32_t i) {
+    entry* e = &c->entries[i];
+    uint32_t* link = &c->buckets[bucket_of(c, e->tag)];
+    while (*link != i) {
+        link = &c->entries[*link].chain;
+    }
+    *link = e->chain;
+    unlink_recency(c, i);
+    unlink_expiry(c, i);
+
+    memzero(e, sizeof(entry));
+    e->chain = c->free_entry;
+    c->free_entry = i;
+}
+
+static void remove_expired(seed_cache* c, uint64_t now) {
+    if (c->ttl_ns == 0) {
+        return;
+    }
+    while (c->first_expiring != NIL && now >= c->entries[c->first_expiring].expires) {
+        remove_entry(c, c->first_expiring);
+    }
+}
+
+static uint32_t find_entry(const seed_cache* c, const uint8_t* tag) {
+    for (uint32_t i = c->buckets[bucket_of(c, tag)]; i != NIL; i = c->entries[i].chain) {
+        if (memcmp(c->entries[i].tag, tag, TAG_LEN) == 0) {
+            return i;
+        }
+    }
+    return NIL;
+}
+
+void* bip39_new_seed_cache(size_t max_entries, uint32_t ttl_seconds) {
+    if (max_entries == 0 || max_entries >= NIL / 2) {
+        return NULL;
+    }
+    seed_cache* c = calloc(sizeof(seed_cache), 1);
+    if (c == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&c->mutex, NULL);
+    c->max_entries = max_entries;
+    c->keys = bip39_secure_alloc(sizeof(keys));
+    if (c->keys == NULL || !bip39_random_bytes((uint8_t*)c->keys, sizeof(keys))) {
+        bip39_dispose_seed_cache(c);
+        return NULL;
+    }
+
+    uint32_t buckets_len = 1;
+    while (buckets_len < max_entries) {
+        buckets_len <<= 1;
+    }
+    c->entries = calloc(sizeof(entry), max_entries);
+    c->buckets = malloc(sizeof(uint32_t) * buckets_len);
+    if (c->entries == NULL || c->buckets == NULL) {
+        bip39_dispose_seed_cache(c);
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < max_entries; i++) {
+        c->entries[i].chain = i + 1 < max_entries ? i + 1 : NIL;
+    }
+    c->free_entry = 0;
+    memset(c->buckets, 0xFF, sizeof(uint32_t) * buckets_len);
+    c->buckets_mask = buckets_len - 1;
+
+    c->newest = c->oldest = NIL;
+    c->first_expiring = c->last_expiring = NIL;
+    c->ttl_ns = (uint64_t)ttl_seconds * 1000000000;
+    return c;
+}
+
+void bip39_dispose_seed_cache(void* cache) {
+    seed_cache* c = cache;
+    if (c->entries != NULL) {
+        memzero(c->entries, sizeof(entry) * c->max_entries);
+        free(c->entries);
+    }
+    free(c->buckets);
+    bip39_secure_free(c->keys, sizeof(keys));
+    pthread_mutex_destroy(&c->mutex);
+    memzero(c, sizeof(seed_cache));
+    free(c);
+}
+
+void bip39_clear_seed_cache(void* cache) {
+    seed_cache* c = cache;
+    pthread_mutex_lock(&c->mutex);
+    while (c->oldest != NIL) {
+        remove_entry(c, c->oldest);
+    }
+    pthread_mutex_unlock(&c->mutex);
+}
+
+bool bip39_cached_seed_from_mnemonics(void* cache, const char* mnemonics, const char* passphrase, uint8_t* seed) {
+    seed_cache* c = cache;
+    if (passphrase == NULL) {
+        passphrase = "";
+    }
+    uint8_t tag[TAG_LEN];
+    compute_tag(c, mnemonics, passphrase, tag);
+
+    pthread_mutex_lock(&c->mutex);
+    remove_expired(c, now_ns());
+    uint32_t i = find_entry(c, tag);
+    if (i != NIL) {
+        entry* e = &c->entries[i];
+        seal(c, e->nonce, e->sealed_seed, seed);
+        unlink_recency(c, i);
+        make_newest(c, i);
+        c->hits++;
+        pthread_mutex_unlock(&c->mutex);
+        memzero(tag, sizeof(tag));
+        return true;
+    }
+    c->misses++;
+    pthread_mutex_unlock(&c->mutex);
+
+    // Derive without holding the lock; other threads may hit meanwhile.
+    if (!bip39_seed_from_mnemonics(mnemonics, passphrase, seed)) {
+        memzero(tag, sizeof(tag));
+        return false;
+    }
+
+    pthread_mutex_lock(&c->mutex);
+    uint64_t now = now_ns();
+    remove_expired(c, now);
+    i = find_entry(c, tag);
+    if (i != NIL) {
+        remove_entry(c, i);
+    }
+    if (c->free_entry == NIL) {
+        remove_entry(c, c->oldest);
+    }
+    i = c->free_entry;
+    entry* e = &c->entries[i];
+    c->free_entry = e->chain;
+
+    memcpy(e->tag, tag, TAG_LEN);
+    e->nonce = c->next_nonce++;
+    seal(c, e->nonce, seed, e->sealed_seed);
+    e->expires = now + c->ttl_ns;
+    uint32_t b = bucket_of(c, tag);
+    e->chain = c->buckets[b];
+    c->buckets[b] = i;
+    make_newest(c, i);
+    make_last_expiring(c, i);
+    pthread_mutex_unlock(&c->mutex);
+
+    memzero(tag, sizeof(tag));
+    return false;
+}
+
+void bip39_seed_cache_stats(void* cache, uint64_t* hits, uint64_t* misses, size_t* entries) {
+    seed_cache* c = cache;
+    pthread_mutex_lock(&c->mutex);
+    remove_expired(c, now_ns());
+    if (hits != NULL) {
+        *hits = c->hits;
+    }
+    if (misses != NULL) {
+        *misses = c->misses;
+    }
+    if (entries != NULL) {
+        size_t n = 0;
+        for (uint32_t i = c->newest; i != NIL; i = c->entries[i].older) {
+            n++;
+        }
+        *entries = n;
+    }
+    pthread_mutex_unlock(&c->mutex);
+}
+
+#endif /* ARDUINO */
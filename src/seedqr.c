@@ -0,0 +1,188 @@
+#include "bip39.h"
+#include "kernels.h"
+
+#include <string.h>
+
+#ifdef ARDUINO
+#include "bc-crypto-base.h"
+#else
+#include <bc-crypto-base/bc-crypto-base.h>
+#endif
+
+// SeedQR encodings. The standard format is each word number as four decimal
+// digits; the compact format is the secret itself, checksum omitted. Both
+// convert straight between word numbers and QR payloads through the codec
+// kernels, so only the standard phrase lengths are accepted.
+
+#define SEEDQR_DIGITS_PER_WORD 4
+
+static void write_digits(const uint16_t* words, size_t words_len, char* digits) {
+    for (size_t i = 0; i < words_len; i++) {
+        uint16_t w = words[i];
+        digits[0] = '0' + w / 1000;
+        digits[1] = '0' + w / 100 % 10;
+        digits[2] = '0' + w / 10 % 10;
+        digits[3] = '0' + w % 10;
+        digits += SEEDQR_DIGITS_PER_WORD;
+    }
+}
+
+static bool read_digits(const char* digits, size_t words_len, uint16_t* words) {
+    for (size_t i = 0; i < words_len; i++) {
+        uint16_t w = 0;
+        for (int j = 0; j < SEEDQR_DIGITS_PER_WORD; j++) {
+            char c = *digits++;
+            if (c < '0' || c > '9') {
+                return false;
+            }
+            w = w * 10 + (c - '0');
+        }
+        if (w > 2047) {
+            return false;
+        }
+        words[i] = w;
+    }
+    return true;
+}
+
+static bool verify_words(const bip39_kernel* kernel, const uint16_t* words, uint8_t* secret) {
+    for (size_t i = 0; i < kernel->words_len; i++) {
+        if (words[i] > 2047) {
+            return false;
+        }
+    }
+    return kernel->decode(words, secret);
+}
+
+size_t bip39_seedqr_from_words(const uint16_t* words, size_t words_len, char* digits, size_t max_digits_len) {
+    size_t digits_len = words_len * SEEDQR_DIGITS_PER_WORD;
+    const bip39_kernel* kernel = bip39_kernel_for_words_len(words_len);
+    if (kernel == NULL || digits_len >= max_digits_len) {
+        return 0;
+    }
+    uint8_t secret[32];
+    bool valid = verify_words(kernel, words, secret);
+    memzero(secret, sizeof(secret));
+    if (!valid) {
+        return 0;
+    }
+    write_digits(words, words_len, digits);
+    digits[digits_len] = '\0';
+    return digits_len;
+}
+
+size_t bip39_words_from_seedqr(const char* digits, size_t digits_len, uint16_t* words, size_t max_words_len) {
+    size_t words_len = digits_len / SEEDQR_DIGITS_PER_WORD;
+    const bip39_kernel* kernel = bip39_kernel_for_words_len(words_len);
+    if (kernel == NULL || digits_len % SEEDQR_DIGITS_PER_WORD != 0 || words_len > max_words_len) {
+        return 0;
+    }
+    uint8_t secret[32];
+    bool valid = read_digits(digits, words_len, words) && kernel->decode(words, secret);
+    memzero(secret, sizeof(secret));
+    if (!valid) {
+        memzero(words, words_len * sizeof(uint16_t));
+        return 0;
+    }
+    return words_len;
+}
+
+size_t bip39_compact_seedqr_from_words(const uint16_t* words, size_t words_len, uint8_t* bytes, size_t max_bytes_len) {
+    const bip39_kernel* kernel = bip39_kernel_for_words_len(words_len);
+    if (kernel == NULL || kernel->secret_len > max_bytes_len) {
+        return 0;
+    }
+    uint8_t secret[32];
+    size_t bytes_len = 0;
+    if (verify_words(kernel, words, secret)) {
+        memcpy(bytes, secret, kernel->secret_len);
+        bytes_len = kernel->secret_len;
+    }
+    memzero(secret, sizeof(secret));
+    return bytes_len;
+}
+
+size_t bip39_words_from_compact_seedqr(const uint8_t* bytes, size_t bytes_len, uint16_t* words, size_t max_words_len) {
+    const bip39_kernel* kernel = bip39_kernel_for_secret_len(bytes_len);
+    if (kernel == NULL || kernel->words_len > max_words_len) {
+        return 0;
+    }
+    kernel->encode(bytes, words);
+    return kernel->words_len;
+}
+
+size_t bip39_seedqr_from_words_batch(const uint16_t* words, size_t words_len, size_t count, char* digits, bool* valid) {
+    const bip39_kernel* kernel = bip39_kernel_for_words_len(words_len);
+    size_t valid_count = 0;
+    uint8_t secret[32];
+    for (size_t i = 0; i < count; i++) {
+        const uint16_t* record = words + i * words_len;
+        char* out = digits + i * words_len * SEEDQR_DIGITS_PER_WORD;
+        bool ok = kernel != NULL && verify_words(kernel, record, secret);
+        if (ok) {
+            write_digits(record, words_len, out);
+            valid_count++;
+        } else {
+            memset(out, '0', words_len * SEEDQR_DIGITS_PER_WORD);
+        }
+        if (valid != NULL) {
+            valid[i] = ok;
+        }
+    }
+    memzero(secret, sizeof(secret));
+    return valid_count;
+}
+
+size_t bip39_words_from_seedqr_batch(const char* digits, size_t words_len, size_t count, uint16_t* words, bool* valid) {
+    const bip39_kernel* kernel = bip39_kernel_for_words_len(words_len);
+    size_t valid_count = 0;
+    uint8_t secret[32];
+    for (size_t i = 0; i < count; i++) {
+        const char* record = digits + i * words_len * SEEDQR_DIGITS_PER_WORD;
+        uint16_t* out = words + i * words_len;
+        bool ok = kernel != NULL && read_digits(record, words_len, out) && kernel->decode(out, secret);
+        if (ok) {
+            valid_count++;
+        } else {
+            memset(out, 0, words_len * sizeof(uint16_t));
+        }
+        if (valid != NULL) {
+            valid[i] = ok;
+        }
+    }
+    memzero(secret, sizeof(secret));
+    return valid_count;
+}
+
+size_t bip39_compact_seedqr_from_words_batch(const uint16_t* words, size_t words_len, size_t count, uint8_t* bytes, bool* valid) {
+    const bip39_kernel* kernel = bip39_kernel_for_words_len(words_len);
+    size_t valid_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        bool ok = false;
+        if (kernel != NULL) {
+            uint8_t* out = bytes + i * kernel->secret_len;
+            ok = bip39_compact_seedqr_from_words(words + i * words_len, words_len, out, kernel->secret_len) != 0;
+            if (!ok) {
+                memset(out, 0, kernel->secret_len);
+            }
+        }
+        if (ok) {
+            valid_count++;
+        }
+        if (valid != NULL) {
+            valid[i] = ok;
+        }
+    }
+    return valid_count;
+}
+
+size_t bip39_words_from_compact_seedqr_batch(const uint8_t* bytes, size_t bytes_len, size_t count, uint16_t* words) {
+    const bip39_kernel* kernel = bip39_kernel_for_secret_len(bytes_len);
+    if (kernel == NULL) {
+        return 0;
+    }
+    for (size_t i = 0; i < count; i++) {
+        kernel->encode(bytes + i * bytes_len, words + i * kernel->words_len);
+    }
+    return count;
+}
@@ -1,517 +1,298 @@
 #include "suffix_array.h"
-#include "suffix_strings.inc"
 
-const char* const bip39_suffix[] PROGMEM = {
-    bip39_s_andon,  bip39_s_ility,  bip39_s_le,     bip39_s_out,
-    bip39_s_ove,    bip39_s_sent,   bip39_s_sorb,   bip39_s_stract,
-    bip39_s_surd,   bip39_s_use,    bip39_s_cess,   bip39_s_cident,
-    bip39_s_count,  bip39_s_cuse,   bip39_s_hieve,  bip39_s_id,
-    bip39_s_oustic, bip39_s_quire,  bip39_s_ross,   bip39_s_t,
-    bip39_s_tion,   bip39_s_tor,    bip39_s_tress,  bip39_s_tual,
-    bip39_s_apt,    bip39_s_d,      bip39_s_dict,   bip39_s_dress,
-    bip39_s_just,   bip39_s_mit,    bip39_s_ult,    bip39_s_vance,
-    bip39_s_vice,   bip39_s_robic,  bip39_s_fair,   bip39_s_ford,
-    bip39_s_raid,   bip39_s_ain,    bip39_s_e,      bip39_s_ent,
-    bip39_s_ree,    bip39_s_ead,    bip39_s_m,      bip39_s_r,
-    bip39_s_rport,  bip39_s_sle,    bip39_s_arm,    bip39_s_bum,
-    bip39_s_cohol,  bip39_s_ert,    bip39_s_ien,    bip39_s_l,
-    bip39_s_ley,    bip39_s_low,    bip39_s_most,   bip39_s_one,
-    bip39_s_pha,    bip39_s_ready,  bip39_s_so,     bip39_s_ter,
-    bip39_s_ways,   bip39_s_ateur,  bip39_s_azing,  bip39_s_ong,
-    bip39_s_ount,   bip39_s_used,   bip39_s_alyst,  bip39_s_chor,
-    bip39_s_cient,  bip39_s_ger,    bip39_s_gle,    bip39_s_gry,
-    bip39_s_imal,   bip39_s_kle,    bip39_s_nounce, bip39_s_nual,
-    bip39_s_other,  bip39_s_swer,   bip39_s_tenna,  bip39_s_tique,
-    bip39_s_xiety,  bip39_s_y,      bip39_s_art,    bip39_s_ology,
-    bip39_s_pear,   bip39_s_ple,    bip39_s_prove,  bip39_s_ril,
-    bip39_s_ch,     bip39_s_ctic,   bip39_s_ea,     bip39_s_ena,
-    bip39_s_gue,    bip39_s_m,      bip39_s_med,    bip39_s_mor,
-    bip39_s_my,     bip39_s_ound,   bip39_s_range,  bip39_s_rest,
-    bip39_s_rive,   bip39_s_row,    bip39_s_t,      bip39_s_tefact,
-    bip39_s_tist,   bip39_s_twork,  bip39_s_k,      bip39_s_pect,
-    bip39_s_sault,  bip39_s_set,    bip39_s_sist,   bip39_s_sume,
-    bip39_s_thma,   bip39_s_hlete,  bip39_s_om,     bip39_s_tack,
-    bip39_s_tend,   bip39_s_titude, bip39_s_tract,  bip39_s_ction,
-    bip39_s_dit,    bip39_s_gust,   bip39_s_nt,     bip39_s_thor,
-    bip39_s_to,     bip39_s_tumn,   bip39_s_erage,  bip39_s_ocado,
-    bip39_s_oid,    bip39_s_ake,    bip39_s_are,    bip39_s_ay,
-    bip39_s_esome,  bip39_s_ful,    bip39_s_kward,  bip39_s_is,
-    bip39_s_by,     bip39_s_chelor, bip39_s_con,    bip39_s_dge,
-    bip39_s_g,      bip39_s_lance,  bip39_s_lcony,  bip39_s_ll,
-    bip39_s_mboo,   bip39_s_nana,   bip39_s_nner,   bip39_s_r,
-    bip39_s_rely,   bip39_s_rgain,  bip39_s_rrel,   bip39_s_se,
-    bip39_s_sic,    bip39_s_sket,   bip39_s_ttle,   bip39_s_ach,
-    bip39_s_an,     bip39_s_auty,   bip39_s_cause,  bip39_s_come,
-    bip39_s_ef,     bip39_s_fore,   bip39_s_gin,    bip39_s_have,
-    bip39_s_hind,   bip39_s_lieve,  bip39_s_low,    bip39_s_lt,
-    bip39_s_nch,    bip39_s_nefit,  bip39_s_st,     bip39_s_tray,
-    bip39_s_tter,   bip39_s_tween,  bip39_s_yond,   bip39_s_cycle,
-    bip39_s_d,      bip39_s_ke,     bip39_s_nd,     bip39_s_ology,
-    bip39_s_rd,     bip39_s_rth,    bip39_s_tter,   bip39_s_ack,
-    bip39_s_ade,    bip39_s_ame,    bip39_s_anket,  bip39_s_ast,
-    bip39_s_eak,    bip39_s_ess,    bip39_s_ind,    bip39_s_ood,
-    bip39_s_ossom,  bip39_s_ouse,   bip39_s_ue,     bip39_s_ur,
-    bip39_s_ush,    bip39_s_ard,    bip39_s_at,     bip39_s_dy,
-    bip39_s_il,     bip39_s_mb,     bip39_s_ne,     bip39_s_nus,
-    bip39_s_ok,     bip39_s_ost,    bip39_s_rder,   bip39_s_ring,
-    bip39_s_rrow,   bip39_s_ss,     bip39_s_ttom,   bip39_s_unce,
-    bip39_s_x,      bip39_s_y,      bip39_s_acket,  bip39_s_ain,
-    bip39_s_and,    bip39_s_ass,    bip39_s_ave,    bip39_s_ead,
-    bip39_s_eeze,   bip39_s_ick,    bip39_s_idge,   bip39_s_ief,
-    bip39_s_ight,   bip39_s_ing,    bip39_s_isk,    bip39_s_occoli,
-    bip39_s_oken,   bip39_s_onze,   bip39_s_oom,    bip39_s_other,
-    bip39_s_own,    bip39_s_ush,    bip39_s_bble,   bip39_s_ddy,
-    bip39_s_dget,   bip39_s_ffalo,  bip39_s_ild,    bip39_s_lb,
-    bip39_s_lk,     bip39_s_llet,   bip39_s_ndle,   bip39_s_nker,
-    bip39_s_rden,   bip39_s_rger,   bip39_s_rst,    bip39_s_s,
-    bip39_s_siness, bip39_s_sy,     bip39_s_tter,   bip39_s_yer,
-    bip39_s_zz,     bip39_s_bbage,  bip39_s_bin,    bip39_s_ble,
-    bip39_s_ctus,   bip39_s_ge,     bip39_s_ke,     bip39_s_ll,
-    bip39_s_lm,     bip39_s_mera,   bip39_s_mp,     bip39_s_n,
-    bip39_s_nal,    bip39_s_ncel,   bip39_s_ndy,    bip39_s_nnon,
-    bip39_s_noe,    bip39_s_nvas,   bip39_s_nyon,   bip39_s_pable,
-    bip39_s_pital,  bip39_s_ptain,  bip39_s_r,      bip39_s_rbon,
-    bip39_s_rd,     bip39_s_rgo,    bip39_s_rpet,   bip39_s_rry,
-    bip39_s_rt,     bip39_s_se,     bip39_s_sh,     bip39_s_sino,
-    bip39_s_stle,   bip39_s_sual,   bip39_s_t,      bip39_s_talog,
-    bip39_s_tch,    bip39_s_tegory, bip39_s_ttle,   bip39_s_ught,
-    bip39_s_use,    bip39_s_ution,  bip39_s_ve,     bip39_s_iling,
-    bip39_s_lery,   bip39_s_ment,   bip39_s_nsus,   bip39_s_ntury,
-    bip39_s_real,   bip39_s_rtain,  bip39_s_air,    bip39_s_alk,
-    bip39_s_ampion, bip39_s_ange,   bip39_s_aos,    bip39_s_apter,
-    bip39_s_arge,   bip39_s_ase,    bip39_s_at,     bip39_s_eap,
-    bip39_s_eck,    bip39_s_eese,   bip39_s_ef,     bip39_s_erry,
-    bip39_s_est,    bip39_s_icken,  bip39_s_ief,    bip39_s_ild,
-    bip39_s_imney,  bip39_s_oice,   bip39_s_oose,   bip39_s_ronic,
-    bip39_s_uckle,  bip39_s_unk,    bip39_s_urn,    bip39_s_gar,
-    bip39_s_nnamon, bip39_s_rcle,   bip39_s_tizen,  bip39_s_ty,
-    bip39_s_vil,    bip39_s_aim,    bip39_s_ap,     bip39_s_arify,
-    bip39_s_aw,     bip39_s_ay,     bip39_s_ean,    bip39_s_erk,
-    bip39_s_ever,   bip39_s_ick,    bip39_s_ient,   bip39_s_iff,
-    bip39_s_imb,    bip39_s_inic,   bip39_s_ip,     bip39_s_ock,
-    bip39_s_og,     bip39_s_ose,    bip39_s_oth,    bip39_s_oud,
-    bip39_s_own,    bip39_s_ub,     bip39_s_ump,    bip39_s_uster,
-    bip39_s_utch,   bip39_s_ach,    bip39_s_ast,    bip39_s_conut,
-    bip39_s_de,     bip39_s_ffee,   bip39_s_il,     bip39_s_in,
-    bip39_s_llect,  bip39_s_lor,    bip39_s_lumn,   bip39_s_mbine,
-    bip39_s_me,     bip39_s_mfort,  bip39_s_mic,    bip39_s_mmon,
-    bip39_s_mpany,  bip39_s_ncert,  bip39_s_nduct,  bip39_s_nfirm,
-    bip39_s_ngress, bip39_s_nnect,  bip39_s_nsider, bip39_s_ntrol,
-    bip39_s_nvince, bip39_s_ok,     bip39_s_ol,     bip39_s_pper,
-    bip39_s_py,     bip39_s_ral,    bip39_s_re,     bip39_s_rn,
-    bip39_s_rrect,  bip39_s_st,     bip39_s_tton,   bip39_s_uch,
-    bip39_s_untry,  bip39_s_uple,   bip39_s_urse,   bip39_s_usin,
-    bip39_s_ver,    bip39_s_yote,   bip39_s_ack,    bip39_s_adle,
-    bip39_s_aft,    bip39_s_am,     bip39_s_ane,    bip39_s_ash,
-    bip39_s_ater,   bip39_s_awl,    bip39_s_azy,    bip39_s_eam,
-    bip39_s_edit,   bip39_s_eek,    bip39_s_ew,     bip39_s_icket,
-    bip39_s_ime,    bip39_s_isp,    bip39_s_itic,   bip39_s_op,
-    bip39_s_oss,    bip39_s_ouch,   bip39_s_owd,    bip39_s_ucial,
-    bip39_s_uel,    bip39_s_uise,   bip39_s_umble,  bip39_s_unch,
-    bip39_s_ush,    bip39_s_y,      bip39_s_ystal,  bip39_s_be,
-    bip39_s_lture,  bip39_s_p,      bip39_s_pboard, bip39_s_rious,
-    bip39_s_rrent,  bip39_s_rtain,  bip39_s_rve,    bip39_s_shion,
-    bip39_s_stom,   bip39_s_te,     bip39_s_cle,    bip39_s_d,
-    bip39_s_mage,   bip39_s_mp,     bip39_s_nce,    bip39_s_nger,
-    bip39_s_ring,   bip39_s_sh,     bip39_s_ughter, bip39_s_wn,
-    bip39_s_y,      bip39_s_al,     bip39_s_bate,   bip39_s_bris,
-    bip39_s_cade,   bip39_s_cember, bip39_s_cide,   bip39_s_cline,
-    bip39_s_corate, bip39_s_crease, bip39_s_er,     bip39_s_fense,
-    bip39_s_fine,   bip39_s_fy,     bip39_s_gree,   bip39_s_lay,
-    bip39_s_liver,  bip39_s_mand,   bip39_s_mise,   bip39_s_nial,
-    bip39_s_ntist,  bip39_s_ny,     bip39_s_part,   bip39_s_pend,
-    bip39_s_posit,  bip39_s_pth,    bip39_s_puty,   bip39_s_rive,
-    bip39_s_scribe, bip39_s_sert,   bip39_s_sign,   bip39_s_sk,
-    bip39_s_spair,  bip39_s_stroy,  bip39_s_tail,   bip39_s_tect,
-    bip39_s_velop,  bip39_s_vice,   bip39_s_vote,   bip39_s_agram,
-    bip39_s_al,     bip39_s_amond,  bip39_s_ary,    bip39_s_ce,
-    bip39_s_esel,   bip39_s_et,     bip39_s_ffer,   bip39_s_gital,
-    bip39_s_gnity,  bip39_s_lemma,  bip39_s_nner,   bip39_s_nosaur,
-    bip39_s_rect,   bip39_s_rt,     bip39_s_sagree, bip39_s_scover,
-    bip39_s_sease,  bip39_s_sh,     bip39_s_smiss,  bip39_s_sorder,
-    bip39_s_splay,  bip39_s_stance, bip39_s_vert,   bip39_s_vide,
-    bip39_s_vorce,  bip39_s_zzy,    bip39_s_ctor,   bip39_s_cument,
-    bip39_s_g,      bip39_s_ll,     bip39_s_lphin,  bip39_s_main,
-    bip39_s_nate,   bip39_s_nkey,   bip39_s_nor,    bip39_s_or,
-    bip39_s_se,     bip39_s_uble,   bip39_s_ve,     bip39_s_aft,
-    bip39_s_agon,   bip39_s_ama,    bip39_s_astic,  bip39_s_aw,
-    bip39_s_eam,    bip39_s_ess,    bip39_s_ift,    bip39_s_ill,
-    bip39_s_ink,    bip39_s_ip,     bip39_s_ive,    bip39_s_op,
-    bip39_s_um,     bip39_s_y,      bip39_s_ck,     bip39_s_mb,
-    bip39_s_ne,     bip39_s_ring,   bip39_s_st,     bip39_s_tch,
-    bip39_s_ty,     bip39_s_arf,    bip39_s_namic,  bip39_s_ger,
-    bip39_s_gle,    bip39_s_rly,    bip39_s_rn,     bip39_s_rth,
-    bip39_s_sily,   bip39_s_st,     bip39_s_sy,     bip39_s_ho,
-    bip39_s_ology,  bip39_s_onomy,  bip39_s_ge,     bip39_s_it,
-    bip39_s_ucate,  bip39_s_fort,   bip39_s_g,      bip39_s_ght,
-    bip39_s_ther,   bip39_s_bow,    bip39_s_der,    bip39_s_ectric,
-    bip39_s_egant,  bip39_s_ement,  bip39_s_ephant, bip39_s_evator,
-    bip39_s_ite,    bip39_s_se,     bip39_s_bark,   bip39_s_body,
-    bip39_s_brace,  bip39_s_erge,   bip39_s_otion,  bip39_s_ploy,
-    bip39_s_power,  bip39_s_pty,    bip39_s_able,   bip39_s_act,
-    bip39_s_d,      bip39_s_dless,  bip39_s_dorse,  bip39_s_emy,
-    bip39_s_ergy,   bip39_s_force,  bip39_s_gage,   bip39_s_gine,
-    bip39_s_hance,  bip39_s_joy,    bip39_s_list,   bip39_s_ough,
-    bip39_s_rich,   bip39_s_roll,   bip39_s_sure,   bip39_s_ter,
-    bip39_s_tire,   bip39_s_try,    bip39_s_velope, bip39_s_isode,
-    bip39_s_ual,    bip39_s_uip,    bip39_s_a,      bip39_s_ase,
-    bip39_s_ode,    bip39_s_osion,  bip39_s_ror,    bip39_s_upt,
-    bip39_s_cape,   bip39_s_say,    bip39_s_sence,  bip39_s_tate,
-    bip39_s_ernal,  bip39_s_hics,   bip39_s_idence, bip39_s_il,
-    bip39_s_oke,    bip39_s_olve,   bip39_s_act,    bip39_s_ample,
-    bip39_s_cess,   bip39_s_change, bip39_s_cite,   bip39_s_clude,
-    bip39_s_cuse,   bip39_s_ecute,  bip39_s_ercise, bip39_s_haust,
-    bip39_s_hibit,  bip39_s_ile,    bip39_s_ist,    bip39_s_it,
-    bip39_s_otic,   bip39_s_pand,   bip39_s_pect,   bip39_s_pire,
-    bip39_s_plain,  bip39_s_pose,   bip39_s_press,  bip39_s_tend,
-    bip39_s_tra,    bip39_s_e,      bip39_s_ebrow,  bip39_s_bric,
-    bip39_s_ce,     bip39_s_culty,  bip39_s_de,     bip39_s_int,
-    bip39_s_ith,    bip39_s_ll,     bip39_s_lse,    bip39_s_me,
-    bip39_s_mily,   bip39_s_mous,   bip39_s_n,      bip39_s_ncy,
-    bip39_s_ntasy,  bip39_s_rm,     bip39_s_shion,  bip39_s_t,
-    bip39_s_tal,    bip39_s_ther,   bip39_s_tigue,  bip39_s_ult,
-    bip39_s_vorite, bip39_s_ature,  bip39_s_bruary, bip39_s_deral,
-    bip39_s_e,      bip39_s_ed,     bip39_s_el,     bip39_s_male,
-    bip39_s_nce,    bip39_s_stival, bip39_s_tch,    bip39_s_ver,
-    bip39_s_w,      bip39_s_ber,    bip39_s_ction,  bip39_s_eld,
-    bip39_s_gure,   bip39_s_le,     bip39_s_lm,     bip39_s_lter,
-    bip39_s_nal,    bip39_s_nd,     bip39_s_ne,     bip39_s_nger,
-    bip39_s_nish,   bip39_s_re,     bip39_s_rm,     bip39_s_rst,
-    bip39_s_scal,   bip39_s_sh,     bip39_s_t,      bip39_s_tness,
-    bip39_s_x,      bip39_s_ag,     bip39_s_ame,    bip39_s_ash,
-    bip39_s_at,     bip39_s_avor,   bip39_s_ee,     bip39_s_ight,
-    bip39_s_ip,     bip39_s_oat,    bip39_s_ock,    bip39_s_oor,
-    bip39_s_ower,   bip39_s_uid,    bip39_s_ush,    bip39_s_y,
-    bip39_s_am,     bip39_s_cus,    bip39_s_g,      bip39_s_il,
-    bip39_s_ld,     bip39_s_llow,   bip39_s_od,     bip39_s_ot,
-    bip39_s_rce,    bip39_s_rest,   bip39_s_rget,   bip39_s_rk,
-    bip39_s_rtune,  bip39_s_rum,    bip39_s_rward,  bip39_s_ssil,
-    bip39_s_ster,   bip39_s_und,    bip39_s_x,      bip39_s_agile,
-    bip39_s_ame,    bip39_s_equent, bip39_s_esh,    bip39_s_iend,
-    bip39_s_inge,   bip39_s_og,     bip39_s_ont,    bip39_s_ost,
-    bip39_s_own,    bip39_s_ozen,   bip39_s_uit,    bip39_s_el,
-    bip39_s_n,      bip39_s_nny,    bip39_s_rnace,  bip39_s_ry,
-    bip39_s_ture,   bip39_s_dget,   bip39_s_in,     bip39_s_laxy,
-    bip39_s_llery,  bip39_s_me,     bip39_s_p,      bip39_s_rage,
-    bip39_s_rbage,  bip39_s_rden,   bip39_s_rlic,   bip39_s_rment,
-    bip39_s_s,      bip39_s_sp,     bip39_s_te,     bip39_s_ther,
-    bip39_s_uge,    bip39_s_ze,     bip39_s_neral,  bip39_s_nius,
-    bip39_s_nre,    bip39_s_ntle,   bip39_s_nuine,  bip39_s_sture,
-    bip39_s_ost,    bip39_s_ant,    bip39_s_ft,     bip39_s_ggle,
-    bip39_s_nger,   bip39_s_raffe,  bip39_s_rl,     bip39_s_ve,
-    bip39_s_ad,     bip39_s_ance,   bip39_s_are,    bip39_s_ass,
-    bip39_s_ide,    bip39_s_impse,  bip39_s_obe,    bip39_s_oom,
-    bip39_s_ory,    bip39_s_ove,    bip39_s_ow,     bip39_s_ue,
-    bip39_s_at,     bip39_s_ddess,  bip39_s_ld,     bip39_s_od,
-    bip39_s_ose,    bip39_s_rilla,  bip39_s_spel,   bip39_s_ssip,
-    bip39_s_vern,   bip39_s_wn,     bip39_s_ab,     bip39_s_ace,
-    bip39_s_ain,    bip39_s_ant,    bip39_s_ape,    bip39_s_ass,
-    bip39_s_avity,  bip39_s_eat,    bip39_s_een,    bip39_s_id,
-    bip39_s_ief,    bip39_s_it,     bip39_s_ocery,  bip39_s_oup,
-    bip39_s_ow,     bip39_s_unt,    bip39_s_ard,    bip39_s_ess,
-    bip39_s_ide,    bip39_s_ilt,    bip39_s_itar,   bip39_s_n,
-    bip39_s_m,      bip39_s_bit,    bip39_s_ir,     bip39_s_lf,
-    bip39_s_mmer,   bip39_s_mster,  bip39_s_nd,     bip39_s_ppy,
-    bip39_s_rbor,   bip39_s_rd,     bip39_s_rsh,    bip39_s_rvest,
-    bip39_s_t,      bip39_s_ve,     bip39_s_wk,     bip39_s_zard,
-    bip39_s_ad,     bip39_s_alth,   bip39_s_art,    bip39_s_avy,
-    bip39_s_dgehog, bip39_s_ight,   bip39_s_llo,    bip39_s_lmet,
-    bip39_s_lp,     bip39_s_n,      bip39_s_ro,     bip39_s_dden,
-    bip39_s_gh,     bip39_s_ll,     bip39_s_nt,     bip39_s_p,
-    bip39_s_re,     bip39_s_story,  bip39_s_bby,    bip39_s_ckey,
-    bip39_s_ld,     bip39_s_le,     bip39_s_liday,  bip39_s_llow,
-    bip39_s_me,     bip39_s_ney,    bip39_s_od,     bip39_s_pe,
-    bip39_s_rn,     bip39_s_rror,   bip39_s_rse,    bip39_s_spital,
-    bip39_s_st,     bip39_s_tel,    bip39_s_ur,     bip39_s_ver,
-    bip39_s_b,      bip39_s_ge,     bip39_s_man,    bip39_s_mble,
-    bip39_s_mor,    bip39_s_ndred,  bip39_s_ngry,   bip39_s_nt,
-    bip39_s_rdle,   bip39_s_rry,    bip39_s_rt,     bip39_s_sband,
-    bip39_s_brid,   bip39_s_e,      bip39_s_on,     bip39_s_ea,
-    bip39_s_entify, bip39_s_le,     bip39_s_nore,   bip39_s_l,
-    bip39_s_legal,  bip39_s_lness,  bip39_s_age,    bip39_s_itate,
-    bip39_s_mense,  bip39_s_mune,   bip39_s_pact,   bip39_s_pose,
-    bip39_s_prove,  bip39_s_pulse,  bip39_s_ch,     bip39_s_clude,
-    bip39_s_come,   bip39_s_crease, bip39_s_dex,    bip39_s_dicate,
-    bip39_s_door,   bip39_s_dustry, bip39_s_fant,   bip39_s_flict,
-    bip39_s_form,   bip39_s_hale,   bip39_s_herit,  bip39_s_itial,
-    bip39_s_ject,   bip39_s_jury,   bip39_s_mate,   bip39_s_ner,
-    bip39_s_nocent, bip39_s_put,    bip39_s_quiry,  bip39_s_sane,
-    bip39_s_sect,   bip39_s_side,   bip39_s_spire,  bip39_s_stall,
-    bip39_s_tact,   bip39_s_terest, bip39_s_to,     bip39_s_vest,
-    bip39_s_vite,   bip39_s_volve,  bip39_s_on,     bip39_s_land,
-    bip39_s_olate,  bip39_s_sue,    bip39_s_em,     bip39_s_ory,
-    bip39_s_cket,   bip39_s_guar,   bip39_s_r,      bip39_s_zz,
-    bip39_s_alous,  bip39_s_ans,    bip39_s_lly,    bip39_s_wel,
-    bip39_s_b,      bip39_s_in,     bip39_s_ke,     bip39_s_urney,
-    bip39_s_y,      bip39_s_dge,    bip39_s_ice,    bip39_s_mp,
-    bip39_s_ngle,   bip39_s_nior,   bip39_s_nk,     bip39_s_st,
-    bip39_s_ngaroo, bip39_s_en,     bip39_s_ep,     bip39_s_tchup,
-    bip39_s_y,      bip39_s_ck,     bip39_s_d,      bip39_s_dney,
-    bip39_s_nd,     bip39_s_ngdom,  bip39_s_ss,     bip39_s_t,
-    bip39_s_tchen,  bip39_s_te,     bip39_s_tten,   bip39_s_wi,
-    bip39_s_ee,     bip39_s_ife,    bip39_s_ock,    bip39_s_ow,
-    bip39_s_b,      bip39_s_bel,    bip39_s_bor,    bip39_s_dder,
-    bip39_s_dy,     bip39_s_ke,     bip39_s_mp,     bip39_s_nguage,
-    bip39_s_ptop,   bip39_s_rge,    bip39_s_ter,    bip39_s_tin,
-    bip39_s_ugh,    bip39_s_undry,  bip39_s_va,     bip39_s_w,
-    bip39_s_wn,     bip39_s_wsuit,  bip39_s_yer,    bip39_s_zy,
-    bip39_s_ader,   bip39_s_af,     bip39_s_arn,    bip39_s_ave,
-    bip39_s_cture,  bip39_s_ft,     bip39_s_g,      bip39_s_gal,
-    bip39_s_gend,   bip39_s_isure,  bip39_s_mon,    bip39_s_nd,
-    bip39_s_ngth,   bip39_s_ns,     bip39_s_opard,  bip39_s_sson,
-    bip39_s_tter,   bip39_s_vel,    bip39_s_ar,     bip39_s_berty,
-    bip39_s_brary,  bip39_s_cense,  bip39_s_fe,     bip39_s_ft,
-    bip39_s_ght,    bip39_s_ke,     bip39_s_mb,     bip39_s_mit,
-    bip39_s_nk,     bip39_s_on,     bip39_s_quid,   bip39_s_st,
-    bip39_s_ttle,   bip39_s_ve,     bip39_s_zard,   bip39_s_ad,
-    bip39_s_an,     bip39_s_bster,  bip39_s_cal,    bip39_s_ck,
-    bip39_s_gic,    bip39_s_nely,   bip39_s_ng,     bip39_s_op,
-    bip39_s_ttery,  bip39_s_ud,     bip39_s_unge,   bip39_s_ve,
-    bip39_s_yal,    bip39_s_cky,    bip39_s_ggage,  bip39_s_mber,
-    bip39_s_nar,    bip39_s_nch,    bip39_s_xury,   bip39_s_rics,
-    bip39_s_chine,  bip39_s_d,      bip39_s_gic,    bip39_s_gnet,
-    bip39_s_id,     bip39_s_il,     bip39_s_in,     bip39_s_jor,
-    bip39_s_ke,     bip39_s_mmal,   bip39_s_n,      bip39_s_nage,
-    bip39_s_ndate,  bip39_s_ngo,    bip39_s_nsion,  bip39_s_nual,
-    bip39_s_ple,    bip39_s_rble,   bip39_s_rch,    bip39_s_rgin,
-    bip39_s_rine,   bip39_s_rket,   bip39_s_rriage, bip39_s_sk,
-    bip39_s_ss,     bip39_s_ster,   bip39_s_tch,    bip39_s_terial,
-    bip39_s_th,     bip39_s_trix,   bip39_s_tter,   bip39_s_ximum,
-    bip39_s_ze,     bip39_s_adow,   bip39_s_an,     bip39_s_asure,
-    bip39_s_at,     bip39_s_chanic, bip39_s_dal,    bip39_s_dia,
-    bip39_s_lody,   bip39_s_lt,     bip39_s_mber,   bip39_s_mory,
-    bip39_s_ntion,  bip39_s_nu,     bip39_s_rcy,    bip39_s_rge,
-    bip39_s_rit,    bip39_s_rry,    bip39_s_sh,     bip39_s_ssage,
-    bip39_s_tal,    bip39_s_thod,   bip39_s_ddle,   bip39_s_dnight,
-    bip39_s_lk,     bip39_s_llion,  bip39_s_mic,    bip39_s_nd,
-    bip39_s_nimum,  bip39_s_nor,    bip39_s_nute,   bip39_s_racle,
-    bip39_s_rror,   bip39_s_sery,   bip39_s_ss,     bip39_s_stake,
-    bip39_s_x,      bip39_s_xed,    bip39_s_xture,  bip39_s_bile,
-    bip39_s_del,    bip39_s_dify,   bip39_s_m,      bip39_s_ment,
-    bip39_s_nitor,  bip39_s_nkey,   bip39_s_nster,  bip39_s_nth,
-    bip39_s_on,     bip39_s_ral,    bip39_s_re,     bip39_s_rning,
-    bip39_s_squito, bip39_s_ther,   bip39_s_tion,   bip39_s_tor,
-    bip39_s_untain, bip39_s_use,    bip39_s_ve,     bip39_s_vie,
-    bip39_s_ch,     bip39_s_ffin,   bip39_s_le,     bip39_s_ltiply,
-    bip39_s_scle,   bip39_s_seum,   bip39_s_shroom, bip39_s_sic,
-    bip39_s_st,     bip39_s_tual,   bip39_s_self,   bip39_s_stery,
-    bip39_s_th,     bip39_s_ive,    bip39_s_me,     bip39_s_pkin,
-    bip39_s_rrow,   bip39_s_sty,    bip39_s_tion,   bip39_s_ture,
-    bip39_s_ar,     bip39_s_ck,     bip39_s_ed,     bip39_s_gative,
-    bip39_s_glect,  bip39_s_ither,  bip39_s_phew,   bip39_s_rve,
-    bip39_s_st,     bip39_s_t,      bip39_s_twork,  bip39_s_utral,
-    bip39_s_ver,    bip39_s_ws,     bip39_s_xt,     bip39_s_ce,
-    bip39_s_ght,    bip39_s_ble,    bip39_s_ise,    bip39_s_minee,
-    bip39_s_odle,   bip39_s_rmal,   bip39_s_rth,    bip39_s_se,
-    bip39_s_table,  bip39_s_te,     bip39_s_thing,  bip39_s_tice,
-    bip39_s_vel,    bip39_s_w,      bip39_s_clear,  bip39_s_mber,
-    bip39_s_rse,    bip39_s_t,      bip39_s_k,      bip39_s_ey,
-    bip39_s_ject,   bip39_s_lige,   bip39_s_scure,  bip39_s_serve,
-    bip39_s_tain,   bip39_s_vious,  bip39_s_cur,    bip39_s_ean,
-    bip39_s_tober,  bip39_s_or,     bip39_s_f,      bip39_s_fer,
-    bip39_s_fice,   bip39_s_ten,    bip39_s_l,      bip39_s_ay,
-    bip39_s_d,      bip39_s_ive,    bip39_s_ympic,  bip39_s_it,
-    bip39_s_ce,     bip39_s_e,      bip39_s_ion,    bip39_s_line,
-    bip39_s_ly,     bip39_s_en,     bip39_s_era,    bip39_s_inion,
-    bip39_s_pose,   bip39_s_tion,   bip39_s_ange,   bip39_s_bit,
-    bip39_s_chard,  bip39_s_der,    bip39_s_dinary, bip39_s_gan,
-    bip39_s_ient,   bip39_s_iginal, bip39_s_phan,   bip39_s_trich,
-    bip39_s_her,    bip39_s_tdoor,  bip39_s_ter,    bip39_s_tput,
-    bip39_s_tside,  bip39_s_al,     bip39_s_en,     bip39_s_er,
-    bip39_s_n,      bip39_s_ner,    bip39_s_ygen,   bip39_s_ster,
-    bip39_s_one,    bip39_s_ct,     bip39_s_ddle,   bip39_s_ge,
-    bip39_s_ir,     bip39_s_lace,   bip39_s_lm,     bip39_s_nda,
-    bip39_s_nel,    bip39_s_nic,    bip39_s_nther,  bip39_s_per,
-    bip39_s_rade,   bip39_s_rent,   bip39_s_rk,     bip39_s_rrot,
-    bip39_s_rty,    bip39_s_ss,     bip39_s_tch,    bip39_s_th,
-    bip39_s_tient,  bip39_s_trol,   bip39_s_ttern,  bip39_s_use,
-    bip39_s_ve,     bip39_s_yment,  bip39_s_ace,    bip39_s_anut,
-    bip39_s_ar,     bip39_s_asant,  bip39_s_lican,  bip39_s_n,
-    bip39_s_nalty,  bip39_s_ncil,   bip39_s_ople,   bip39_s_pper,
-    bip39_s_rfect,  bip39_s_rmit,   bip39_s_rson,   bip39_s_t,
-    bip39_s_one,    bip39_s_oto,    bip39_s_rase,   bip39_s_ysical,
-    bip39_s_ano,    bip39_s_cnic,   bip39_s_cture,  bip39_s_ece,
-    bip39_s_g,      bip39_s_geon,   bip39_s_ll,     bip39_s_lot,
-    bip39_s_nk,     bip39_s_oneer,  bip39_s_pe,     bip39_s_stol,
-    bip39_s_tch,    bip39_s_zza,    bip39_s_ace,    bip39_s_anet,
-    bip39_s_astic,  bip39_s_ate,    bip39_s_ay,     bip39_s_ease,
-    bip39_s_edge,   bip39_s_uck,    bip39_s_ug,     bip39_s_unge,
-    bip39_s_em,     bip39_s_et,     bip39_s_int,    bip39_s_lar,
-    bip39_s_le,     bip39_s_lice,   bip39_s_nd,     bip39_s_ny,
-    bip39_s_ol,     bip39_s_pular,  bip39_s_rtion,  bip39_s_sition,
-    bip39_s_ssible, bip39_s_st,     bip39_s_tato,   bip39_s_ttery,
-    bip39_s_verty,  bip39_s_wder,   bip39_s_wer,    bip39_s_actice,
-    bip39_s_aise,   bip39_s_edict,  bip39_s_efer,   bip39_s_epare,
-    bip39_s_esent,  bip39_s_etty,   bip39_s_event,  bip39_s_ice,
-    bip39_s_ide,    bip39_s_imary,  bip39_s_int,    bip39_s_iority,
-    bip39_s_ison,   bip39_s_ivate,  bip39_s_ize,    bip39_s_oblem,
-    bip39_s_ocess,  bip39_s_oduce,  bip39_s_ofit,   bip39_s_ogram,
-    bip39_s_oject,  bip39_s_omote,  bip39_s_oof,    bip39_s_operty,
-    bip39_s_osper,  bip39_s_otect,  bip39_s_oud,    bip39_s_ovide,
-    bip39_s_blic,   bip39_s_dding,  bip39_s_ll,     bip39_s_lp,
-    bip39_s_lse,    bip39_s_mpkin,  bip39_s_nch,    bip39_s_pil,
-    bip39_s_ppy,    bip39_s_rchase, bip39_s_rity,   bip39_s_rpose,
-    bip39_s_rse,    bip39_s_sh,     bip39_s_t,      bip39_s_zzle,
-    bip39_s_ramid,  bip39_s_ality,  bip39_s_antum,  bip39_s_arter,
-    bip39_s_estion, bip39_s_ick,    bip39_s_it,     bip39_s_iz,
-    bip39_s_ote,    bip39_s_bbit,   bip39_s_ccoon,  bip39_s_ce,
-    bip39_s_ck,     bip39_s_dar,    bip39_s_dio,    bip39_s_il,
-    bip39_s_in,     bip39_s_ise,    bip39_s_lly,    bip39_s_mp,
-    bip39_s_nch,    bip39_s_ndom,   bip39_s_nge,    bip39_s_pid,
-    bip39_s_re,     bip39_s_te,     bip39_s_ther,   bip39_s_ven,
-    bip39_s_w,      bip39_s_zor,    bip39_s_ady,    bip39_s_al,
-    bip39_s_ason,   bip39_s_bel,    bip39_s_build,  bip39_s_call,
-    bip39_s_ceive,  bip39_s_cipe,   bip39_s_cord,   bip39_s_cycle,
-    bip39_s_duce,   bip39_s_flect,  bip39_s_form,   bip39_s_fuse,
-    bip39_s_gion,   bip39_s_gret,   bip39_s_gular,  bip39_s_ject,
-    bip39_s_lax,    bip39_s_lease,  bip39_s_lief,   bip39_s_ly,
-    bip39_s_main,   bip39_s_member, bip39_s_mind,   bip39_s_move,
-    bip39_s_nder,   bip39_s_new,    bip39_s_nt,     bip39_s_open,
-    bip39_s_pair,   bip39_s_peat,   bip39_s_place,  bip39_s_port,
-    bip39_s_quire,  bip39_s_scue,   bip39_s_semble, bip39_s_sist,
-    bip39_s_source, bip39_s_sponse, bip39_s_sult,   bip39_s_tire,
-    bip39_s_treat,  bip39_s_turn,   bip39_s_union,  bip39_s_veal,
-    bip39_s_view,   bip39_s_ward,   bip39_s_ythm,   bip39_s_b,
-    bip39_s_bbon,   bip39_s_ce,     bip39_s_ch,     bip39_s_de,
-    bip39_s_dge,    bip39_s_fle,    bip39_s_ght,    bip39_s_gid,
-    bip39_s_ng,     bip39_s_ot,     bip39_s_pple,   bip39_s_sk,
-    bip39_s_tual,   bip39_s_val,    bip39_s_ver,    bip39_s_ad,
-    bip39_s_ast,    bip39_s_bot,    bip39_s_bust,   bip39_s_cket,
-    bip39_s_mance,  bip39_s_of,     bip39_s_okie,   bip39_s_om,
-    bip39_s_se,     bip39_s_tate,   bip39_s_ugh,    bip39_s_und,
-    bip39_s_ute,    bip39_s_yal,    bip39_s_bber,   bip39_s_de,
-    bip39_s_g,      bip39_s_le,     bip39_s_n,      bip39_s_nway,
-    bip39_s_ral,    bip39_s_d,      bip39_s_ddle,   bip39_s_dness,
-    bip39_s_fe,     bip39_s_il,     bip39_s_lad,    bip39_s_lmon,
-    bip39_s_lon,    bip39_s_lt,     bip39_s_lute,   bip39_s_me,
-    bip39_s_mple,   bip39_s_nd,     bip39_s_tisfy,  bip39_s_toshi,
-    bip39_s_uce,    bip39_s_usage,  bip39_s_ve,     bip39_s_y,
-    bip39_s_ale,    bip39_s_an,     bip39_s_are,    bip39_s_atter,
-    bip39_s_ene,    bip39_s_heme,   bip39_s_hool,   bip39_s_ience,
-    bip39_s_issors, bip39_s_orpion, bip39_s_out,    bip39_s_rap,
-    bip39_s_reen,   bip39_s_ript,   bip39_s_rub,    bip39_s_a,
-    bip39_s_arch,   bip39_s_ason,   bip39_s_at,     bip39_s_cond,
-    bip39_s_cret,   bip39_s_ction,  bip39_s_curity, bip39_s_ed,
-    bip39_s_ek,     bip39_s_gment,  bip39_s_lect,   bip39_s_ll,
-    bip39_s_minar,  bip39_s_nior,   bip39_s_nse,    bip39_s_ntence,
-    bip39_s_ries,   bip39_s_rvice,  bip39_s_ssion,  bip39_s_ttle,
-    bip39_s_tup,    bip39_s_ven,    bip39_s_adow,   bip39_s_aft,
-    bip39_s_allow,  bip39_s_are,    bip39_s_ed,     bip39_s_ell,
-    bip39_s_eriff,  bip39_s_ield,   bip39_s_ift,    bip39_s_ine,
-    bip39_s_ip,     bip39_s_iver,   bip39_s_ock,    bip39_s_oe,
-    bip39_s_oot,    bip39_s_op,     bip39_s_ort,    bip39_s_oulder,
-    bip39_s_ove,    bip39_s_rimp,   bip39_s_rug,    bip39_s_uffle,
-    bip39_s_y,      bip39_s_bling,  bip39_s_ck,     bip39_s_de,
-    bip39_s_ege,    bip39_s_ght,    bip39_s_gn,     bip39_s_lent,
-    bip39_s_lk,     bip39_s_lly,    bip39_s_lver,   bip39_s_milar,
-    bip39_s_mple,   bip39_s_nce,    bip39_s_ng,     bip39_s_ren,
-    bip39_s_ster,   bip39_s_tuate,  bip39_s_x,      bip39_s_ze,
-    bip39_s_ate,    bip39_s_etch,   bip39_s_i,      bip39_s_ill,
-    bip39_s_in,     bip39_s_irt,    bip39_s_ull,    bip39_s_ab,
-    bip39_s_am,     bip39_s_eep,    bip39_s_ender,  bip39_s_ice,
-    bip39_s_ide,    bip39_s_ight,   bip39_s_im,     bip39_s_ogan,
-    bip39_s_ot,     bip39_s_ow,     bip39_s_ush,    bip39_s_all,
-    bip39_s_art,    bip39_s_ile,    bip39_s_oke,    bip39_s_ooth,
-    bip39_s_ack,    bip39_s_ake,    bip39_s_ap,     bip39_s_iff,
-    bip39_s_ow,     bip39_s_ap,     bip39_s_ccer,   bip39_s_cial,
-    bip39_s_ck,     bip39_s_da,     bip39_s_ft,     bip39_s_lar,
-    bip39_s_ldier,  bip39_s_lid,    bip39_s_lution, bip39_s_lve,
-    bip39_s_meone,  bip39_s_ng,     bip39_s_on,     bip39_s_rry,
-    bip39_s_rt,     bip39_s_ul,     bip39_s_und,    bip39_s_up,
-    bip39_s_urce,   bip39_s_uth,    bip39_s_ace,    bip39_s_are,
-    bip39_s_atial,  bip39_s_awn,    bip39_s_eak,    bip39_s_ecial,
-    bip39_s_eed,    bip39_s_ell,    bip39_s_end,    bip39_s_here,
-    bip39_s_ice,    bip39_s_ider,   bip39_s_ike,    bip39_s_in,
-    bip39_s_irit,   bip39_s_lit,    bip39_s_oil,    bip39_s_onsor,
-    bip39_s_oon,    bip39_s_ort,    bip39_s_ot,     bip39_s_ray,
-    bip39_s_read,   bip39_s_ring,   bip39_s_y,      bip39_s_uare,
-    bip39_s_ueeze,  bip39_s_uirrel, bip39_s_able,   bip39_s_adium,
-    bip39_s_aff,    bip39_s_age,    bip39_s_airs,   bip39_s_amp,
-    bip39_s_and,    bip39_s_art,    bip39_s_ate,    bip39_s_ay,
-    bip39_s_eak,    bip39_s_eel,    bip39_s_em,     bip39_s_ep,
-    bip39_s_ereo,   bip39_s_ick,    bip39_s_ill,    bip39_s_ing,
-    bip39_s_ock,    bip39_s_omach,  bip39_s_one,    bip39_s_ool,
-    bip39_s_ory,    bip39_s_ove,    bip39_s_rategy, bip39_s_reet,
-    bip39_s_rike,   bip39_s_rong,   bip39_s_ruggle, bip39_s_udent,
-    bip39_s_uff,    bip39_s_umble,  bip39_s_yle,    bip39_s_bject,
-    bip39_s_bmit,   bip39_s_bway,   bip39_s_ccess,  bip39_s_ch,
-    bip39_s_dden,   bip39_s_ffer,   bip39_s_gar,    bip39_s_ggest,
-    bip39_s_it,     bip39_s_mmer,   bip39_s_n,      bip39_s_nny,
-    bip39_s_nset,   bip39_s_per,    bip39_s_pply,   bip39_s_preme,
-    bip39_s_re,     bip39_s_rface,  bip39_s_rge,    bip39_s_rprise,
-    bip39_s_rround, bip39_s_rvey,   bip39_s_spect,  bip39_s_stain,
-    bip39_s_allow,  bip39_s_amp,    bip39_s_ap,     bip39_s_arm,
-    bip39_s_ear,    bip39_s_eet,    bip39_s_ift,    bip39_s_im,
-    bip39_s_ing,    bip39_s_itch,   bip39_s_ord,    bip39_s_mbol,
-    bip39_s_mptom,  bip39_s_rup,    bip39_s_stem,   bip39_s_ble,
-    bip39_s_ckle,   bip39_s_g,      bip39_s_il,     bip39_s_lent,
-    bip39_s_lk,     bip39_s_nk,     bip39_s_pe,     bip39_s_rget,
-    bip39_s_sk,     bip39_s_ste,    bip39_s_ttoo,   bip39_s_xi,
-    bip39_s_ach,    bip39_s_am,     bip39_s_ll,     bip39_s_n,
-    bip39_s_nant,   bip39_s_nnis,   bip39_s_nt,     bip39_s_rm,
-    bip39_s_st,     bip39_s_xt,     bip39_s_ank,    bip39_s_at,
-    bip39_s_eme,    bip39_s_en,     bip39_s_eory,   bip39_s_ere,
-    bip39_s_ey,     bip39_s_ing,    bip39_s_is,     bip39_s_ought,
-    bip39_s_ree,    bip39_s_rive,   bip39_s_row,    bip39_s_umb,
-    bip39_s_under,  bip39_s_cket,   bip39_s_de,     bip39_s_ger,
-    bip39_s_lt,     bip39_s_mber,   bip39_s_me,     bip39_s_ny,
-    bip39_s_p,      bip39_s_red,    bip39_s_ssue,   bip39_s_tle,
-    bip39_s_ast,    bip39_s_bacco,  bip39_s_day,    bip39_s_ddler,
-    bip39_s_e,      bip39_s_gether, bip39_s_ilet,   bip39_s_ken,
-    bip39_s_mato,   bip39_s_morrow, bip39_s_ne,     bip39_s_ngue,
-    bip39_s_night,  bip39_s_ol,     bip39_s_oth,    bip39_s_p,
-    bip39_s_pic,    bip39_s_pple,   bip39_s_rch,    bip39_s_rnado,
-    bip39_s_rtoise, bip39_s_ss,     bip39_s_tal,    bip39_s_urist,
-    bip39_s_ward,   bip39_s_wer,    bip39_s_wn,     bip39_s_y,
-    bip39_s_ack,    bip39_s_ade,    bip39_s_affic,  bip39_s_agic,
-    bip39_s_ain,    bip39_s_ansfer, bip39_s_ap,     bip39_s_ash,
-    bip39_s_avel,   bip39_s_ay,     bip39_s_eat,    bip39_s_ee,
-    bip39_s_end,    bip39_s_ial,    bip39_s_ibe,    bip39_s_ick,
-    bip39_s_igger,  bip39_s_im,     bip39_s_ip,     bip39_s_ophy,
-    bip39_s_ouble,  bip39_s_uck,    bip39_s_ue,     bip39_s_uly,
-    bip39_s_umpet,  bip39_s_ust,    bip39_s_uth,    bip39_s_y,
-    bip39_s_be,     bip39_s_ition,  bip39_s_mble,   bip39_s_na,
-    bip39_s_nnel,   bip39_s_rkey,   bip39_s_rn,     bip39_s_rtle,
-    bip39_s_elve,   bip39_s_enty,   bip39_s_ice,    bip39_s_in,
-    bip39_s_ist,    bip39_s_o,      bip39_s_pe,     bip39_s_pical,
-    bip39_s_ly,     bip39_s_brella, bip39_s_able,   bip39_s_aware,
-    bip39_s_cle,    bip39_s_cover,  bip39_s_der,    bip39_s_do,
-    bip39_s_fair,   bip39_s_fold,   bip39_s_happy,  bip39_s_iform,
-    bip39_s_ique,   bip39_s_it,     bip39_s_iverse, bip39_s_known,
-    bip39_s_lock,   bip39_s_til,    bip39_s_usual,  bip39_s_veil,
-    bip39_s_date,   bip39_s_grade,  bip39_s_hold,   bip39_s_on,
-    bip39_s_per,    bip39_s_set,    bip39_s_ban,    bip39_s_ge,
-    bip39_s_age,    bip39_s_e,      bip39_s_ed,     bip39_s_eful,
-    bip39_s_eless,  bip39_s_ual,    bip39_s_ility,  bip39_s_cant,
-    bip39_s_cuum,   bip39_s_gue,    bip39_s_lid,    bip39_s_lley,
-    bip39_s_lve,    bip39_s_n,      bip39_s_nish,   bip39_s_por,
-    bip39_s_rious,  bip39_s_st,     bip39_s_ult,    bip39_s_hicle,
-    bip39_s_lvet,   bip39_s_ndor,   bip39_s_nture,  bip39_s_nue,
-    bip39_s_rb,     bip39_s_rify,   bip39_s_rsion,  bip39_s_ry,
-    bip39_s_ssel,   bip39_s_teran,  bip39_s_able,   bip39_s_brant,
-    bip39_s_cious,  bip39_s_ctory,  bip39_s_deo,    bip39_s_ew,
-    bip39_s_llage,  bip39_s_ntage,  bip39_s_olin,   bip39_s_rtual,
-    bip39_s_rus,    bip39_s_sa,     bip39_s_sit,    bip39_s_sual,
-    bip39_s_tal,    bip39_s_vid,    bip39_s_cal,    bip39_s_ice,
-    bip39_s_id,     bip39_s_lcano,  bip39_s_lume,   bip39_s_te,
-    bip39_s_yage,   bip39_s_ge,     bip39_s_gon,    bip39_s_it,
-    bip39_s_lk,     bip39_s_ll,     bip39_s_lnut,   bip39_s_nt,
-    bip39_s_rfare,  bip39_s_rm,     bip39_s_rrior,  bip39_s_sh,
-    bip39_s_sp,     bip39_s_ste,    bip39_s_ter,    bip39_s_ve,
-    bip39_s_y,      bip39_s_alth,   bip39_s_apon,   bip39_s_ar,
-    bip39_s_asel,   bip39_s_ather,  bip39_s_b,      bip39_s_dding,
-    bip39_s_ekend,  bip39_s_ird,    bip39_s_lcome,  bip39_s_st,
-    bip39_s_t,      bip39_s_ale,    bip39_s_at,     bip39_s_eat,
-    bip39_s_eel,    bip39_s_en,     bip39_s_ere,    bip39_s_ip,
-    bip39_s_isper,  bip39_s_de,     bip39_s_dth,    bip39_s_fe,
-    bip39_s_ld,     bip39_s_ll,     bip39_s_n,      bip39_s_ndow,
-    bip39_s_ne,     bip39_s_ng,     bip39_s_nk,     bip39_s_nner,
-    bip39_s_nter,   bip39_s_re,     bip39_s_sdom,   bip39_s_se,
-    bip39_s_sh,     bip39_s_tness,  bip39_s_lf,     bip39_s_man,
-    bip39_s_nder,   bip39_s_od,     bip39_s_ol,     bip39_s_rd,
-    bip39_s_rk,     bip39_s_rld,    bip39_s_rry,    bip39_s_rth,
-    bip39_s_ap,     bip39_s_eck,    bip39_s_estle,  bip39_s_ist,
-    bip39_s_ite,    bip39_s_ong,    bip39_s_rd,     bip39_s_ar,
-    bip39_s_llow,   bip39_s_u,      bip39_s_ung,    bip39_s_uth,
-    bip39_s_bra,    bip39_s_ro,     bip39_s_ne,     bip39_s_o,
+// Every word's letters after the first two, as NUL-terminated strings. A
+// suffix that ends another suffix shares its bytes.
+const char bip39_suffix_strings[] PROGMEM =
+    "ab\0acket\0actice\0ader\0adium\0adle\0adow\0af\0aff\0affic\0aft\0ag\0"
+    "agic\0agile\0agon\0agram\0aim\0airs\0aise\0ality\0alk\0allow\0alous\0"
+    "alth\0alyst\0ama\0ame\0amond\0amp\0ampion\0ample\0andon\0anet\0ank\0"
+    "anket\0ans\0ansfer\0antum\0anut\0aos\0apon\0apt\0apter\0arch\0arf\0arge\0"
+    "arify\0arm\0arn\0arter\0asant\0asel\0ash\0ason\0ass\0ast\0astic\0asure\0"
+    "ater\0ateur\0ather\0atial\0atter\0ature\0auty\0avel\0avity\0avor\0avy\0"
+    "aw\0aware\0awl\0awn\0azing\0azy\0bacco\0ban\0bark\0bate\0bbage\0bber\0"
+    "bbit\0bble\0bbon\0bby\0bel\0berty\0bile\0bin\0bject\0blic\0bling\0bmit\0"
+    "body\0bot\0bow\0bra\0brace\0brant\0brary\0brella\0bric\0brid\0bris\0"
+    "bruary\0bster\0build\0bum\0bust\0bway\0cade\0call\0cant\0cape\0cause\0"
+    "ccer\0ccess\0ccoon\0ceive\0cember\0cense\0change\0chanic\0chard\0chelor\0"
+    "chine\0chor\0cide\0cident\0cient\0cious\0cipe\0cite\0ckey\0cky\0clear\0"
+    "cline\0clude\0cnic\0cohol\0con\0cond\0conut\0corate\0cord\0count\0"
+    "crease\0cret\0ctic\0ction\0ctor\0ctory\0cture\0ctus\0culty\0cument\0cur\0"
+    "curity\0cus\0cuse\0cuum\0cycle\0dal\0dar\0dden\0dder\0ddess\0dding\0"
+    "ddle\0ddler\0ddy\0del\0deo\0deral\0dex\0dgehog\0dget\0dia\0dicate\0dify\0"
+    "dinary\0dio\0dless\0dness\0dney\0dnight\0dorse\0dress\0dth\0dustry\0ea\0"
+    "eak\0eam\0ean\0eap\0ebrow\0ece\0ecial\0eck\0ectric\0ecute\0edge\0edict\0"
+    "edit\0eed\0eek\0eel\0eep\0eese\0efer\0eful\0egant\0ege\0ekend\0eless\0"
+    "ell\0elve\0ement\0emy\0ena\0ender\0ene\0entify\0enty\0eory\0epare\0"
+    "ephant\0equent\0erage\0ercise\0ereo\0erge\0ergy\0eriff\0erk\0ernal\0"
+    "erry\0esel\0esent\0esh\0esome\0estion\0estle\0etch\0etty\0evator\0event\0"
+    "ever\0fair\0fant\0fense\0ffalo\0ffee\0ffer\0ffin\0fice\0fine\0flect\0"
+    "flict\0fold\0force\0ford\0fore\0fuse\0gar\0gative\0gend\0geon\0gether\0"
+    "ggage\0ggest\0gid\0gine\0gion\0gital\0glect\0gment\0gnet\0gnity\0grade\0"
+    "gret\0guar\0gular\0gure\0gust\0hale\0hance\0happy\0haust\0have\0heme\0"
+    "here\0herit\0hibit\0hicle\0hics\0hieve\0hind\0hlete\0ho\0hold\0hool\0"
+    "ick\0icken\0icket\0idence\0idge\0ield\0ien\0ience\0iend\0ife\0iform\0"
+    "ift\0igger\0iginal\0ilet\0iling\0ility\0ill\0ilt\0imal\0imary\0imb\0ime\0"
+    "imney\0impse\0inge\0inic\0inion\0ink\0int\0iority\0ird\0irit\0irt\0isk\0"
+    "isode\0ison\0isp\0isper\0issors\0isure\0itar\0itate\0itch\0ith\0ither\0"
+    "itial\0itic\0ivate\0iverse\0iz\0ize\0jor\0joy\0jury\0just\0known\0kward\0"
+    "lad\0lance\0land\0lax\0laxy\0lb\0lcano\0lcome\0lcony\0ldier\0lease\0"
+    "legal\0lemma\0lent\0lican\0lice\0lid\0liday\0lief\0lieve\0lige\0list\0"
+    "lit\0liver\0llage\0llect\0llery\0llet\0lley\0llion\0llo\0lly\0lm\0lmet\0"
+    "lmon\0lness\0lnut\0lock\0lody\0lon\0lot\0lp\0lphin\0lter\0ltiply\0lture\0"
+    "lume\0lumn\0lute\0lution\0lver\0lvet\0mage\0main\0male\0man\0mance\0"
+    "mand\0mate\0mato\0mbine\0mbol\0mboo\0med\0member\0mense\0meone\0mera\0"
+    "mfort\0milar\0mily\0minar\0mind\0minee\0mise\0mmal\0mmer\0mmon\0mor\0"
+    "morrow\0mory\0most\0mous\0move\0mpany\0mpkin\0mptom\0mster\0mune\0nage\0"
+    "nalty\0namic\0nana\0nant\0nate\0ncel\0ncert\0ncil\0ncy\0nda\0ndate\0"
+    "ndle\0ndom\0ndor\0ndow\0ndred\0nduct\0ndy\0nefit\0nely\0neral\0new\0"
+    "nfirm\0ngaroo\0ngdom\0nger\0ngle\0ngo\0ngress\0ngry\0ngth\0nguage\0ngue\0"
+    "nial\0nimum\0nior\0nish\0nitor\0nius\0nker\0nkey\0nnamon\0nnect\0nnel\0"
+    "nner\0nnis\0nnon\0nny\0nocent\0noe\0nor\0nore\0nosaur\0nounce\0nre\0"
+    "nset\0nsider\0nsion\0nster\0nsus\0ntage\0ntasy\0ntence\0nter\0nth\0"
+    "nther\0ntion\0ntist\0ntle\0ntrol\0nture\0ntury\0nu\0nual\0nue\0nuine\0"
+    "nus\0nute\0nvas\0nvince\0nway\0nyon\0oat\0obe\0oblem\0ocado\0occoli\0"
+    "ocery\0ocess\0odle\0oduce\0ofit\0ogan\0ogram\0oice\0oid\0oil\0oject\0ok\0"
+    "oke\0oken\0okie\0olate\0olin\0ology\0omach\0omote\0oneer\0onomy\0onsor\0"
+    "ont\0onze\0ood\0oof\0oose\0oot\0ooth\0opard\0open\0operty\0ophy\0ople\0"
+    "orpion\0osion\0osper\0ossom\0otect\0other\0otic\0otion\0oto\0ouble\0"
+    "ouch\0oud\0ough\0ought\0oulder\0oup\0ouse\0oustic\0out\0ovide\0owd\0"
+    "ozen\0pable\0pact\0pand\0part\0pboard\0pear\0peat\0pend\0pha\0phan\0"
+    "phew\0pical\0pid\0pil\0place\0plain\0ploy\0por\0posit\0power\0pper\0"
+    "pple\0pply\0preme\0press\0prove\0ptain\0pth\0ptop\0pty\0pular\0pulse\0"
+    "puty\0quid\0quire\0quiry\0racle\0raffe\0raid\0ramid\0range\0rap\0rase\0"
+    "rategy\0rbage\0rble\0rbon\0rbor\0rchase\0rcle\0rcy\0rden\0rdle\0read\0"
+    "ready\0real\0reen\0reet\0rely\0ren\0rface\0rfare\0rfect\0rgain\0rger\0"
+    "rget\0rgin\0rgo\0rics\0ries\0rike\0ril\0rilla\0rimp\0rine\0ring\0rious\0"
+    "ript\0rive\0rket\0rkey\0rl\0rld\0rlic\0rly\0rmal\0rment\0rmit\0rnace\0"
+    "rnado\0rning\0ro\0robic\0roll\0rong\0ronic\0ross\0rpet\0rport\0rpose\0"
+    "rprise\0rrect\0rrent\0rriage\0rrior\0rror\0rrot\0rround\0rsh\0rsion\0"
+    "rson\0rst\0rtain\0rth\0rtion\0rtle\0rtoise\0rtual\0rtune\0rub\0rug\0"
+    "ruggle\0rum\0rup\0rus\0rvest\0rvey\0rvice\0rward\0sa\0sagree\0sane\0"
+    "sault\0say\0sband\0scal\0scle\0scover\0scribe\0scue\0scure\0sdom\0sease\0"
+    "sect\0self\0semble\0sence\0sert\0serve\0sery\0seum\0shion\0shroom\0sic\0"
+    "sign\0sily\0siness\0sino\0sist\0sition\0sket\0sle\0smiss\0so\0sorb\0"
+    "sorder\0source\0spair\0spect\0spel\0spire\0spital\0splay\0sponse\0"
+    "squito\0ssage\0ssel\0ssible\0ssil\0ssion\0ssip\0sson\0ssue\0stain\0"
+    "stake\0stall\0stance\0ste\0stem\0stery\0stival\0stol\0stom\0story\0"
+    "stract\0stroy\0sture\0sty\0sult\0sume\0surd\0swer\0table\0tack\0tact\0"
+    "tail\0talog\0tato\0tchen\0tchup\0tdoor\0tefact\0tegory\0tel\0tend\0"
+    "tenna\0teran\0terest\0terial\0thing\0thma\0thod\0thor\0tient\0tigue\0"
+    "til\0tin\0tique\0tire\0tisfy\0titude\0tizen\0tness\0tober\0toshi\0tput\0"
+    "tra\0tray\0treat\0tress\0trich\0trix\0tside\0tten\0ttern\0ttery\0ttle\0"
+    "ttom\0tton\0ttoo\0tuate\0tumn\0tup\0turn\0tween\0twork\0uare\0ucate\0"
+    "ucial\0uck\0uckle\0udent\0ueeze\0uel\0uff\0uffle\0uge\0ughter\0uip\0"
+    "uirrel\0uise\0ull\0uly\0umb\0umble\0ump\0umpet\0unch\0under\0undry\0ung\0"
+    "unge\0union\0unk\0untain\0untry\0uple\0upt\0urist\0urney\0urse\0usage\0"
+    "used\0ush\0usin\0uster\0usual\0utch\0uth\0utral\0va\0vance\0veal\0veil\0"
+    "velop\0velope\0ven\0vern\0vert\0verty\0vid\0vie\0view\0vil\0vious\0vite\0"
+    "volve\0vorce\0vorite\0vote\0ways\0wder\0wel\0wi\0wk\0ws\0wsuit\0xed\0xi\0"
+    "xiety\0ximum\0xt\0xture\0xury\0yage\0yal\0yer\0ygen\0yle\0yment\0ympic\0"
+    "yond\0yote\0ysical\0ystal\0ythm\0zard\0zor\0zz\0zza\0zzle\0zzy\0";
+
+const uint16_t bip39_suffix_offsets[] PROGMEM = {
+    157,  1683, 29,   3118, 2331, 1250, 4008, 4184, 4217, 583,
+    593,  666,  760,  839,  1567, 520,  3111, 3315, 3638, 7,
+    784,  790,  4435, 3757, 209,  138,  1062, 987,  1880, 467,
+    3835, 4760, 3807, 3616, 1306, 1376, 3339, 2172, 14,   669,
+    3824, 3420, 25,   19,   3648, 3995, 239,  547,  727,  2403,
+    1630, 262,  2047, 105,  2320, 2241, 3180, 3424, 4005, 215,
+    4861, 298,  370,  3628, 761,  4716, 120,  656,  673,  1661,
+    2508, 2524, 1697, 4550, 2651, 2763, 3048, 4222, 4300, 4367,
+    4897, 97,   3154, 2922, 3165, 153,  3268, 3512, 221,  778,
+    1004, 1144, 2541, 25,   2222, 2304, 1141, 3704, 3350, 4314,
+    3548, 1025, 7,    4277, 2732, 4521, 101,  4034, 3833, 2663,
+    3978, 4212, 4332, 1578, 2350, 4233, 4295, 4384, 4185, 783,
+    1068, 1501, 256,  4342, 2203, 4501, 1195, 2823, 2880, 4129,
+    358,  558,  1259, 1099, 1891, 525,  427,  643,  733,  1057,
+    55,   1901, 1936, 568,  2217, 2381, 2605, 19,   3445, 3472,
+    4597, 90,   3952, 3990, 4475, 2930, 387,  328,  581,  1931,
+    1994, 1381, 3489, 1529, 1573, 1997, 105,  1694, 4636, 2462,
+    123,  4424, 317,  4515, 4957, 849,  138,  2898, 137,  2922,
+    640,  3734, 317,  4234, 562,  130,  172,  277,  1007, 594,
+    1574, 2967, 3036, 3106, 2542, 301,  4721, 639,  2810, 473,
+    2409, 1709, 653,  2778, 2894, 2321, 4015, 3532, 2310, 274,
+    4480, 2653, 916,  97,   3,    2172, 1908, 273,  1530, 3420,
+    4561, 1597, 1620, 1993, 976,  372,  1772, 2829, 2901, 2962,
+    3948, 3048, 1887, 4721, 416,  896,  925,  1322, 543,  1921,
+    100,  2041, 2426, 2577, 3409, 3478, 3724, 86,   3966, 2700,
+    317,  4932, 4994, 400,  445,  417,  806,  230,  2898, 568,
+    2065, 2245, 141,  71,   1235, 2396, 2458, 2615, 2631, 2787,
+    2804, 3137, 4051, 3274, 19,   3383, 640,  3493, 3643, 1240,
+    1769, 90,   265,  3973, 1273, 4737, 7,    4248, 1279, 4284,
+    4475, 3090, 583,  2150, 607,  1677, 2036, 819,  2686, 2754,
+    3430, 3728, 1307, 99,   144,  625,  200,  213,  228,  769,
+    2810, 1019, 1039, 1088, 1994, 1239, 1427, 1601, 1993, 543,
+    1716, 2875, 2975, 3632, 4548, 4667, 4511, 1391, 2587, 3400,
+    4391, 96,   4822, 79,   1020, 233,  353,  558,  1015, 1229,
+    1301, 1597, 674,  1225, 1708, 1733, 4108, 2090, 922,  2976,
+    2985, 3080, 1887, 3769, 4625, 4730, 4742, 2930, 277,  742,
+    563,  1328, 2409, 446,  2029, 646,  2139, 2206, 131,  2250,
+    2377, 2299, 2335, 2401, 2452, 2483, 2516, 2594, 2667, 2742,
+    2792, 2894, 730,  3241, 1520, 910,  290,  244,  3667, 123,
+    4485, 3076, 4678, 4684, 4705, 4725, 1302, 4962, 4234, 27,
+    50,   76,   3829, 264,  293,  362,  376,  1011, 1067, 1076,
+    2480, 1607, 1712, 1787, 1842, 3286, 3639, 3075, 3128, 4538,
+    4566, 4602, 4619, 4635, 4721, 97,   4974, 2814, 2128, 142,
+    3158, 3537, 3673, 3728, 3925, 3939, 4173, 397,  851,  138,
+    2166, 141,  1513, 2502, 3532, 265,  4584, 367,  97,   313,
+    395,  523,  561,  610,  661,  710,  748,  766,  18,   1316,
+    1348, 236,  3823, 4059, 2017, 2191, 2284, 2545, 2731, 1939,
+    3153, 3175, 3229, 3280, 3305, 3548, 3866, 3918, 3956, 1773,
+    4027, 4191, 4243, 3043, 4776, 3807, 4856, 73,   313,  134,
+    502,  13,   1244, 6,    1333, 1445, 1468, 1960, 2605, 2644,
+    3668, 1769, 3821, 3859, 3889, 265,  3999, 4013, 4057, 4139,
+    4798, 3123, 4843, 5006, 789,  817,  55,   568,  2110, 2171,
+    2391, 2582, 2635, 346,  90,   3070, 607,  50,   68,   126,
+    281,  353,  1011, 594,  1655, 1689, 1744, 4108, 606,  3286,
+    24,   97,   1040, 1709, 653,  3532, 123,  1279, 96,   224,
+    2375, 1661, 2508, 3575, 244,  3734, 3961, 123,  2700, 1584,
+    2922, 2946, 230,  413,  4532, 2251, 55,   977,  305,  480,
+    17,   1043, 1103, 1134, 1181, 1288, 691,  90,   390,  471,
+    488,  1213, 3059, 3220, 3235, 3289, 3138, 3144, 138,  957,
+    981,  1140, 1218, 1370, 1420, 1435, 1511, 1871, 2008, 3084,
+    4442, 3622, 288,  215,  4373, 1000, 4782, 1776, 2764, 4591,
+    128,  769,  1778, 3024, 3693, 4689, 576,  3839, 3912, 1816,
+    1233, 1562, 1613, 2409, 2897, 4838, 3144, 151,  593,  623,
+    690,  716,  839,  1050, 1201, 1523, 1550, 64,   2009, 413,
+    3054, 3148, 4034, 4045, 3214, 3655, 3262, 4295, 4420, 14,
+    1023, 513,  13,   811,  563,  1748, 1826, 568,  3301, 131,
+    2262, 2325, 71,   2412, 2697, 240,  3939, 7,    1447, 305,
+    4353, 3835, 4849, 322,  528,  908,  14,   1073, 261,  2176,
+    1513, 4161, 1279, 1302, 35,   407,  783,  1626, 1496, 29,
+    2065, 2116, 1235, 137,  653,  2502, 2561, 290,  240,  3724,
+    3849, 265,  7,    4397, 916,  54,   130,  264,  2810, 344,
+    1330, 976,  4108, 2809, 2090, 4273, 3236, 3311, 4721, 97,
+    76,   835,  55,   2409, 544,  104,  2968, 477,  1372, 4314,
+    3483, 392,  3762, 3783, 3812, 4095, 536,  3705, 916,  62,
+    130,  1188, 1255, 1640, 1728, 922,  2958, 2321, 1887, 3132,
+    4886, 261,  71,   2620, 3595, 503,  323,  925,  446,  1916,
+    2035, 131,  142,  1196, 3372, 3409, 3570, 3584, 86,   1788,
+    397,  305,  4580, 1864, 2473, 2572, 2658, 2737, 2772, 4197,
+    2321, 255,  51,   3778, 2502, 3333, 3563, 607,  1898, 1512,
+    358,  273,  662,  1722, 2813, 3948, 796,  2331, 34,   2542,
+    2810, 873,  544,  2968, 2976, 3516, 4039, 4106, 4793, 367,
+    0,    490,  2172, 255,  577,  273,  338,  3171, 3436, 520,
+    1993, 413,  2836, 3102, 34,   762,  639,  594,  662,  1693,
+    1810, 71,   25,   412,  1308, 3902, 2294, 2353, 137,  1519,
+    3388, 640,  3709, 3795, 7,    607,  4878, 4985, 1898, 115,
+    3154, 349,  918,  976,  2057, 2068, 2107, 71,   3613, 863,
+    3086, 568,  256,  142,  290,  4178, 426,  695,  544,  29,
+    1986, 104,  131,  970,  2968, 578,  244,  3692, 983,  4050,
+    123,  4291, 301,  1302, 1,    230,  2181, 3907, 2304, 2446,
+    2523, 256,  3414, 1240, 1769, 3843, 518,  14,   70,   1004,
+    1158, 29,   2639, 262,  1954, 2078, 402,  1815, 2233, 2359,
+    3143, 3655, 3268, 3299, 221,  716,  1931, 766,  914,  934,
+    4272, 997,  1311, 1359, 1650, 1506, 1544, 1836, 450,  1875,
+    2196, 2606, 2624, 4416, 3321, 3828, 3895, 4453, 4044, 4133,
+    4238, 4312, 2203, 3796, 4832, 4837, 70,   1907, 2911, 4117,
+    2820, 796,  4,    1485, 19,   4994, 109,  178,  2061, 4871,
+    1,    446,  2898, 4699, 97,   1057, 12,   141,  2507, 2556,
+    169,  123,  2489, 865,  1085, 4265, 97,   1040, 138,  969,
+    137,  2496, 274,  7,    4259, 397,  4458, 4875, 1330, 1645,
+    2090, 34,   1,    430,  3389, 868,  473,  2898, 141,  2533,
+    3284, 229,  215,  4363, 3085, 4646, 4757, 35,   367,  4884,
+    4932, 377,  16,   37,   243,  1530, 800,  51,   55,   1956,
+    1402, 1804, 2074, 137,  2528, 179,  2989, 4111, 317,  334,
+    707,  434,  500,  617,  1646, 51,   977,  2898, 1709, 467,
+    169,  70,   3310, 123,  4475, 607,  4985, 1898, 387,  535,
+    3196, 1040, 58,   2468, 373,  3286, 4469, 3081, 4656, 607,
+    4928, 700,  1419, 612,  2269, 4636, 4918, 3497, 650,  138,
+    58,   1463, 520,  2409, 446,  1867, 2898, 2289, 71,   2364,
+    2420, 2512, 2674, 2763, 153,  3378, 220,  3488, 3527, 3553,
+    3679, 1773, 274,  536,  1279, 4319, 117,  4447, 317,  4903,
+    1864, 32,   387,  287,  2810, 630,  855,  930,  2094, 1694,
+    612,  2315, 2725, 2760, 3405, 229,  1546, 1240, 265,  4077,
+    1447, 4337, 885,  974,  100,  2051, 2377, 137,  2550, 2635,
+    2782, 3327, 3692, 3929, 274,  4127, 916,  4890, 4912, 440,
+    900,  941,  25,   819,  2566, 2582, 2680, 2715, 70,   910,
+    290,  3607, 4070, 305,  784,  790,  4671, 583,  607,  4813,
+    221,  1338, 29,   2121, 3854, 3934, 3945, 3952, 123,  3757,
+    3900, 4155, 117,  606,  131,  2342, 2310, 4203, 784,  323,
+    707,  1040, 1073, 1395, 1451, 1830, 3189, 3925, 123,  7,
+    4521, 4751, 1302, 4881, 4909, 13,   977,  417,  89,   2278,
+    2848, 3579, 3734, 90,   4227, 397,  4326, 11,   334,  35,
+    704,  612,  983,  7,    101,  697,  450,  2003, 3878, 3923,
+    3275, 4826, 824,  1015, 4403, 346,  38,   185,  1343, 4459,
+    262,  558,  138,  606,  4951, 413,  13,   14,   147,  711,
+    2062, 865,  2246, 1738, 3655, 784,  625,  412,  637,  17,
+    946,  2865, 674,  1665, 3184, 4441, 306,  4271, 215,  4415,
+    4452, 313,  865,  18,   71,   2606, 4936, 536,  2241, 452,
+    885,  230,  1308, 3209, 2065, 2416, 2601, 633,  2719, 1793,
+    1475, 3674, 392,  3697, 436,  274,  1279, 117,  4347, 2743,
+    4463, 583,  607,  4945, 490,  195,  707,  253,  1971, 71,
+    2369, 2407, 3012, 3241, 3466, 3590, 3719, 7,    2241, 3065,
+    3360, 4967, 1926, 722,  800,  1029, 55,   1407, 568,  2103,
+    169,  2940, 578,  4168, 1279, 4997, 490,  163,  281,  396,
+    558,  768,  1056, 4544, 3773, 4656, 2820, 6,    1748, 1492,
+    29,   1977, 137,  1939, 730,  3293, 3738, 3983, 4088, 123,
+    4254, 4469, 4803, 4866, 3237, 9,    88,   1061, 1093, 1175,
+    1249, 1283, 1295, 12,   662,  1702, 1748, 1752, 1782, 1847,
+    1863, 2817, 2842, 2853, 2859, 2869, 2888, 2934, 2971, 3000,
+    3030, 3042, 3080, 3122, 455,  879,  568,  2107, 3301, 2341,
+    4636, 3204, 1519, 3393, 830,  3654, 983,  265,  7,    5001,
+    3344, 93,   189,  247,  1265, 1597, 413,  1860, 2936, 411,
+    598,  13,   1040, 859,  953,  2409, 446,  89,   2061, 141,
+    4636, 2431, 626,  3200, 290,  397,  305,  4789, 35,   4990,
+    3426, 313,  268,  430,  541,  566,  604,  685,  755,  849,
+    2854, 1353, 1650, 1386, 1440, 1480, 1490, 450,  1912, 1948,
+    1992, 2062, 2171, 2226, 2273, 2330, 1149, 2479, 256,  2995,
+    4028, 3170, 3208, 3649, 3315, 3873, 3905, 3978, 4020, 4063,
+    4207, 4373, 4429, 4510, 4661, 4766, 4817, 1892, 4980, 1,
+    421,  13,   221,  563,  1057, 4576, 977,  1431, 373,  477,
+    3246, 1773, 3757, 4164, 1302, 1898, 277,  476,  551,  4,
+    2185, 2972, 2906, 2350, 90,   1816, 3085, 3705, 1052, 4928,
+    406,  563,  55,   29,   71,   2799, 910,  138,  885,  963,
+    1646, 2409, 1897, 2073, 2099, 1694, 2144, 131,  152,  137,
+    4378, 4409, 2855, 4710, 607,  97,   1507, 387,  358,  316,
+    1154, 1534, 1592, 1634, 1797, 3017, 3118, 3356, 3435, 3543,
+    3768, 128,  219,  268,  2810, 737,  773,  783,  828,  1073,
+    1077, 1457, 1354, 568,  2267, 2556, 619,  2703, 3502, 3806,
+    4100, 4475, 4506, 4789, 32,   50,   103,  358,  1073, 1125,
+    1223, 1625, 1655, 652,  4108, 2018, 2090, 2632, 2980, 3286,
+    2252, 3095, 2331, 3522, 3772, 4574, 97,   460,  1040, 563,
+    1109, 977,  3958, 1966, 100,  2061, 2156, 2256, 152,  1513,
+    373,  3450, 536,  4495, 916,  1864, 396,  1278, 2834, 1689,
+    446,  1768, 4607, 0,    76,   1084, 1148, 12,   662,  976,
+    80,   2864, 477,  34,   4721, 567,  3154, 64,   2897, 2984,
+    4234, 4129, 1020, 1225, 34,   1020, 587,  1034, 1040, 2417,
+    51,   1492, 1942, 1982, 2149, 1130, 2239, 373,  70,   1240,
+    1769, 1100, 3705, 3103, 4022, 4747, 490,  358,  310,  366,
+    1007, 1033, 1072, 1125, 1115, 1539, 12,   2669, 3508, 446,
+    1763, 2013, 2884, 2952, 600,  2252, 477,  4425, 3419, 3532,
+    97,   4527, 4560, 4595, 3138, 21,   40,   402,  83,   140,
+    1908, 3154, 396,  558,  1007, 1080, 2820, 1085, 1208, 1597,
+    1689, 372,  2090, 2928, 2241, 1593, 796,  2331, 3365, 3440,
+    3507, 3627, 3776, 4554, 4570, 4619, 4941, 449,  466,  556,
+    592,  221,  863,  1333, 1391, 1425, 413,  2294, 71,   2620,
+    2662, 1793, 3251, 3256, 290,  3454, 229,  3660, 3702, 3801,
+    4033, 4121, 103,  140,  1020, 239,  706,  3441, 1655, 80,
+    372,  1821, 756,  2212, 2347, 3787, 4150, 417,  4549, 55,
+    2409, 1966, 100,  169,  578,  3483, 1773, 4146, 4490, 4894,
+    2930, 76,   568,  71,   2386, 2610, 256,  240,  123,  4909,
+    168,  2810, 1535, 865,  1170, 1540, 697,  372,  525,  3089,
+    3824, 3548, 1025, 4615, 4640, 4,    563,  1661, 1694, 612,
+    131,  1939, 142,  2448, 4116, 1274, 277,  380,  1988, 890,
+    14,   1412, 1672, 1603, 2201, 2308, 653,  2540, 975,  730,
+    2985, 142,  4953, 3246, 220,  3601, 3749, 274,  1447, 4693,
+    1892, 3237, 367,  97,   4234, 562,  44,   57,   2172, 182,
+    1020, 264,  333,  558,  3171, 1330, 1115, 312,  3869, 1597,
+    1659, 80,   4108, 3007, 3069, 4544, 2542, 4611, 4629, 552,
+    4747, 97,   2814, 3984, 3907, 1145, 2600, 3558, 244,  3744,
+    1129, 1165, 12,   446,  2009, 384,  578,  3194, 2062, 506,
+    3138, 356,  851,  3860, 17,   2826, 1306, 1365, 1517, 1649,
+    4368, 413,  1853, 1885, 2089, 4359, 4736, 4771, 2421, 1474,
+    1587, 70,   1793, 2663, 386,  230,  402,  14,   1073, 1098,
+    1119, 2764, 1683, 571,  844,  2541, 1982, 2046, 1130, 71,
+    2561, 3225, 3537, 123,  3835, 1556, 2161, 2436, 2748, 2768,
+    4010, 234,  3713, 503,  4083, 4306, 3138, 494,  679,  794,
+    904,  2480, 2023, 2691, 2917, 3756, 3791, 3818, 3231, 4737,
+    1447, 4809, 3196, 12,   520,  1924, 2134, 397,  4923, 230,
+    69,   413,  100,  568,  2084, 256,  3460, 240,  3686, 265,
+    1788, 4146, 215,  607,  97,   115,  204,  707,  259,  304,
+    1,    879,  1113, 1759, 1930, 123,  7,    1507, 2810, 3171,
+    1080, 865,  1540, 4108, 1791, 563,  993,  1646, 544,  568,
+    71,   2441, 653,  373,  169,  2605, 2710, 290,  3884, 90,
+    265,  4397, 3902, 2181, 1149, 2968, 730,  640,  392,  3566,
+    1240, 3734, 1020, 1039, 1272, 2009, 691,  3628, 640,  707,
+    104,  2761, 4652, 4747, 484,  3613, 653,  384,
 };
@@ -1,9 +1,15 @@
 #ifndef SUFFIX_ARRAY_H
 #define SUFFIX_ARRAY_H
 
-#include "index_char.h"
+#include <stdint.h>
 #include "arduino-support.h"
 
-extern const char* const bip39_suffix[] PROGMEM;
+// The suffix table holds offsets rather than pointers, so it needs no load
+// time relocations and stays in shared, read-only pages.
+extern const char bip39_suffix_strings[] PROGMEM;
+extern const uint16_t bip39_suffix_offsets[] PROGMEM;
+
+// Returns the flash address of the suffix of word `i`.
+#define BIP39_SUFFIX(i) (bip39_suffix_strings + PGM_READ_WORD(&bip39_suffix_offsets[i]))
 
 #endif /* SUFFIX_ARRAY_H */
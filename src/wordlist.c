@@ -0,0 +1,365 @@
+#ifndef ARDUINO
+
+#include "bip39.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// A wordlist image is a single relocation-free block that can be mapped and
+// used in place. All integers are little-endian and all positions are byte
+// offsets from the start of the image.
+//
+//   0  magic "BIP39WL\0"
+//   8  u16 version
+//  10  u16 word count (2048)
+//  12  u16 bucket count (power of two)
+//  14  u16 slot count (power of two)
+//  16  u32 word offsets: u32[2048], offsets into the string blob
+//  20  u32 string blob: NUL-terminated UTF-8 words
+//  24  u32 string blob length
+//  28  u32 buckets: u16[bucket count] hash displacements
+//  32  u32 slots: u16[slot count] word numbers, 0xFFFF for empty
+//  36  u32 image length
+//
+// Lookup is a perfect hash (hash and displace): a word's 64-bit FNV-1a hash
+// picks a bucket, and the bucket's displacement places every word of the
+// bucket in its own slot, so each lookup probes exactly one slot.
+
+#define WORDLIST_MAGIC "BIP39WL"
+#define WORDLIST_VERSION 1
+#define WORDLIST_HEADER_LEN 40
+#define WORDLIST_WORDS 2048
+#define WORDLIST_BUCKETS 512
+#define WORDLIST_SLOTS 4096
+#define WORDLIST_EMPTY 0xFFFF
+
+typedef struct wordlist_t {
+    const uint8_t* image;
+    size_t image_len;
+    void* mapping;
+
+    const uint8_t* word_offsets;
+    const char* strings;
+    uint32_t strings_len;
+    const uint8_t* buckets;
+    uint16_t bucket_mask;
+    const uint8_t* slots;
+    uint16_t slot_mask;
+} wordlist;
+
+static uint16_t read_u16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t read_u32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void write_u16(uint8_t* p, uint16_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static void write_u32(uint8_t* p, uint32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+static uint64_t hash_word(const char* word, size_t len) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)word[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+static uint16_t hash_bucket(uint64_t h, uint16_t bucket_mask) {
+    return (h >> 32) & bucket_mask;
+}
+
+static uint16_t hash_slot(uint64_t h, uint16_t displacement, uint16_t slot_mask) {
+    uint32_t step = (uint32_t)(h >> 48) | 1;
+    return ((uint32_t)h + displacement * step) & slot_mask;
+}
+
+static bool is_power_of_two(uint16_t n) {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+static bool section_fits(size_t image_len, uint32_t offset, size_t len) {
+    return offset <= image_len && len <= image_len - offset;
+}
+
+void* bip39_wordlist_from_image(const void* image, size_t image_len) {
+    const uint8_t* p = image;
+    if (image_len < WORDLIST_HEADER_LEN || memcmp(p, WORDLIST_MAGIC, 8) != 0) {
+        return NULL;
+    }
+    if (read_u16(p + 8) != WORDLIST_VERSION || read_u16(p + 10) != WORDLIST_WORDS) {
+        return NULL;
+    }
+    uint16_t bucket_count = read_u16(p + 12);
+    uint16_t slot_count = read_u16(p + 14);
+    uint32_t word_offsets = read_u32(p + 16);
+    uint32_t strings = read_u32(p + 20);
+    uint32_t strings_len = read_u32(p + 24);
+    uint32_t buckets = read_u32(p + 28);
+    uint32_t slots = read_u32(p + 32);
+    if (read_u32(p + 36) != image_len ||
+        !is_power_of_two(bucket_count) || !is_power_of_two(slot_count) ||
+        !section_fits(image_len, word_offsets, WORDLIST_WORDS * 4) ||
+        !section_fits(image_len, strings, strings_len) ||
+        !section_fits(image_len, buckets, bucket_count * 2) ||
+        !section_fits(image_len, slots, slot_count * 2) ||
+        strings_len == 0 || p[strings + strings_len - 1] != '\0') {
+        return NULL;
+    }
+
+    wordlist* wl = calloc(sizeof(wordlist), 1);
+    wl->image = p;
+    wl->image_len = image_len;
+    wl->word_offsets = p + word_offsets;
+    wl->strings = (const char*)p + strings;
+    wl->strings_len = strings_len;
+    wl->buckets = p + buckets;
+    wl->bucket_mask = bucket_count - 1;
+    wl->slots = p + slots;
+    wl->slot_mask = slot_count - 1;
+    return wl;
+}
+
+void* bip39_wordlist_open(const char* path) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < WORDLIST_HEADER_LEN) {
+        close(fd);
+        return NULL;
+    }
+    size_t len = st.st_size;
+    void* mapping = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return NULL;
+    }
+    wordlist* wl = bip39_wordlist_from_image(mapping, len);
+    if (wl == NULL) {
+        munmap(mapping, len);
+        return NULL;
+    }
+    wl->mapping = mapping;
+    return wl;
+}
+
+void bip39_wordlist_close(void* wordlist_) {
+    wordlist* wl = wordlist_;
+    if (wl == NULL) {
+        return;
+    }
+    if (wl->mapping != NULL) {
+        munmap(wl->mapping, wl->image_len);
+    }
+    free(wl);
+}
+
+const char* bip39_wordlist_get_mnemonic(const void* wordlist_, uint16_t word) {
+    const wordlist* wl = wordlist_;
+    if (word >= WORDLIST_WORDS) {
+        return NULL;
+    }
+    uint32_t offset = read_u32(wl->word_offsets + word * 4);
+    if (offset >= wl->strings_len) {
+        return NULL;
+    }
+    return wl->strings + offset;
+}
+
+int16_t bip39_wordlist_word_from_mnemonic_len(const void* wordlist_, const char* mnemonic, size_t mnemonic_len) {
+    const wordlist* wl = wordlist_;
+    uint64_t h = hash_word(mnemonic, mnemonic_len);
+    uint16_t displacement = read_u16(wl->buckets + hash_bucket(h, wl->bucket_mask) * 2);
+    uint16_t word = read_u16(wl->slots + hash_slot(h, displacement, wl->slot_mask) * 2);
+    if (word >= WORDLIST_WORDS) {
+        return -1;
+    }
+    // The blob is known to end in a NUL, so strnlen against the rest of it
+    // finds the stored word's length without leaving the image.
+    uint32_t offset = read_u32(wl->word_offsets + word * 4);
+    if (offset >= wl->strings_len) {
+        return -1;
+    }
+    const char* candidate = wl->strings + offset;
+    size_t candidate_len = strnlen(candidate, wl->strings_len - offset);
+    if (candidate_len != mnemonic_len || memcmp(candidate, mnemonic, mnemonic_len) != 0) {
+        return -1;
+    }
+    return word;
+}
+
+int16_t bip39_wordlist_word_from_mnemonic(const void* wordlist, const char* mnemonic) {
+    if (mnemonic == NULL) {
+        return -1;
+    }
+    return bip39_wordlist_word_from_mnemonic_len(wordlist, mnemonic, strlen(mnemonic));
+}
+
+// Finds a displacement for every bucket, largest buckets first, such that
+// all words land in distinct slots. Returns false if no such displacement
+// exists, which only happens for duplicate words.
+static bool build_perfect_hash(const uint64_t* hashes, uint16_t* displacements, uint16_t* slots) {
+    uint16_t bucket_sizes[WORDLIST_BUCKETS] = { 0 };
+    uint16_t bucket_order[WORDLIST_BUCKETS];
+    for (size_t i = 0; i < WORDLIST_WORDS; i++) {
+        bucket_sizes[hash_bucket(hashes[i], WORDLIST_BUCKETS - 1)]++;
+    }
+    for (size_t i = 0; i < WORDLIST_BUCKETS; i++) {
+        bucket_order[i] = i;
+    }
+    for (size_t i = 1; i < WORDLIST_BUCKETS; i++) {
+        uint16_t b = bucket_order[i];
+        size_t j = i;
+        for (; j > 0 && bucket_sizes[bucket_order[j - 1]] < bucket_sizes[b]; j--) {
+            bucket_order[j] = bucket_order[j - 1];
+        }
+        bucket_order[j] = b;
+    }
+
+    for (size_t i = 0; i < WORDLIST_SLOTS; i++) {
+        slots[i] = WORDLIST_EMPTY;
+    }
+    memset(displacements, 0, WORDLIST_BUCKETS * sizeof(uint16_t));
+
+    uint16_t members[WORDLIST_WORDS];
+    uint16_t placed[WORDLIST_WORDS];
+    for (size_t i = 0; i < WORDLIST_BUCKETS; i++) {
+        uint16_t bucket = bucket_order[i];
+        size_t members_len = 0;
+        for (size_t w = 0; w < WORDLIST_WORDS; w++) {
+            if (hash_bucket(hashes[w], WORDLIST_BUCKETS - 1) == bucket) {
+                members[members_len++] = w;
+            }
+        }
+        if (members_len == 0) {
+            break;
+        }
+
+        bool found = false;
+        for (uint32_t d = 0; d <= 0xFFFF && !found; d++) {
+            size_t placed_len = 0;
+            for (; placed_len < members_len; placed_len++) {
+                uint16_t slot = hash_slot(hashes[members[placed_len]], d, WORDLIST_SLOTS - 1);
+                if (slots[slot] != WORDLIST_EMPTY) {
+                    break;
+                }
+                slots[slot] = members[placed_len];
+                placed[placed_len] = slot;
+            }
+            if (placed_len == members_len) {
+                displacements[bucket] = d;
+                found = true;
+            } else {
+                for (size_t j = 0; j < placed_len; j++) {
+                    slots[placed[j]] = WORDLIST_EMPTY;
+                }
+            }
+        }
+        if (!found) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t bip39_wordlist_write_image(const char* const* words, uint8_t* image, size_t max_image_len) {
+    // The English list is 18 KiB; keep it off the stack.
+    char (*english)[9] = NULL;
+    if (words == NULL) {
+        english = malloc(WORDLIST_WORDS * sizeof(*english));
+        if (english == NULL) {
+            return 0;
+        }
+        for (uint16_t i = 0; i < WORDLIST_WORDS; i++) {
+            bip39_mnemonic_from_word(i, english[i]);
+        }
+    }
+
+    size_t strings_len = 0;
+    for (size_t i = 0; i < WORDLIST_WORDS; i++) {
+        const char* word = words == NULL ? english[i] : words[i];
+        if (word == NULL || word[0] == '\0') {
+            free(english);
+            return 0;
+        }
+        strings_len += strlen(word) + 1;
+    }
+
+    size_t word_offsets = WORDLIST_HEADER_LEN;
+    size_t buckets = word_offsets + WORDLIST_WORDS * 4;
+    size_t slots = buckets + WORDLIST_BUCKETS * 2;
+    size_t strings = slots + WORDLIST_SLOTS * 2;
+    size_t image_len = strings + strings_len;
+    if (image == NULL || max_image_len < image_len) {
+        free(english);
+        return image_len;
+    }
+
+    uint64_t* hashes = malloc(WORDLIST_WORDS * sizeof(uint64_t));
+    uint16_t* displacements = malloc(WORDLIST_BUCKETS * sizeof(uint16_t));
+    uint16_t* slot_words = malloc(WORDLIST_SLOTS * sizeof(uint16_t));
+    if (hashes == NULL || displacements == NULL || slot_words == NULL) {
+        free(hashes);
+        free(displacements);
+        free(slot_words);
+        free(english);
+        return 0;
+    }
+
+    memset(image, 0, image_len);
+    size_t offset = 0;
+    for (size_t i = 0; i < WORDLIST_WORDS; i++) {
+        const char* word = words == NULL ? english[i] : words[i];
+        size_t len = strlen(word);
+        hashes[i] = hash_word(word, len);
+        write_u32(image + word_offsets + i * 4, offset);
+        memcpy(image + strings + offset, word, len + 1);
+        offset += len + 1;
+    }
+
+    bool ok = build_perfect_hash(hashes, displacements, slot_words);
+    if (ok) {
+        for (size_t i = 0; i < WORDLIST_BUCKETS; i++) {
+            write_u16(image + buckets + i * 2, displacements[i]);
+        }
+        for (size_t i = 0; i < WORDLIST_SLOTS; i++) {
+            write_u16(image + slots + i * 2, slot_words[i]);
+        }
+        memcpy(image, WORDLIST_MAGIC, 8);
+        write_u16(image + 8, WORDLIST_VERSION);
+        write_u16(image + 10, WORDLIST_WORDS);
+        write_u16(image + 12, WORDLIST_BUCKETS);
+        write_u16(image + 14, WORDLIST_SLOTS);
+        write_u32(image + 16, word_offsets);
+        write_u32(image + 20, strings);
+        write_u32(image + 24, strings_len);
+        write_u32(image + 28, buckets);
+        write_u32(image + 32, slots);
+        write_u32(image + 36, image_len);
+    }
+
+    free(hashes);
+    free(displacements);
+    free(slot_words);
+    free(english);
+
+    return ok ? image_len : 0;
+}
+
+#endif /* ARDUINO */
@@ -0,0 +1,207 @@
+//
+//  bench.c
+//
+//  Copyright © 2020 by Blockchain Commons, LLC
+//  Licensed under the "BSD-2-Clause Plus Patent License"
+//
+//  Times the strict parser against the length-delimited one on adversarial
+//  inputs of growing size. The strict parser's cost should stay flat once
+//  an input passes its limits; the other grows with the input.
+//
+//  Then measures the leak scanner's throughput on a few kinds of stream,
+//  and across files on every core.
+//
+
+#include "../src/bc-bip39.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MAX_BYTES 1024
+#define MAX_WORD_LEN 8
+#define MAX_WORDS 24
+
+typedef struct input_t {
+    const char* name;
+    void (*fill)(char* buf, size_t len);
+} input;
+
+static void fill_letters(char* buf, size_t len) {
+    memset(buf, 'a', len);
+}
+
+static void fill_spaces(char* buf, size_t len) {
+    memset(buf, ' ', len);
+}
+
+static void fill_words(char* buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = "abandon "[i % 8];
+    }
+}
+
+static void fill_short_tokens(char* buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = i % 2 == 0 ? 'x' : ' ';
+    }
+}
+
+static const input inputs[] = {
+    { "one long token", fill_letters },
+    { "separators only", fill_spaces },
+    { "repeated word", fill_words },
+    { "one-letter tokens", fill_short_tokens },
+};
+
+static double now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static size_t iterations_for(size_t len) {
+    size_t n = (64 * 1024 * 1024) / len;
+    return n < 8 ? 8 : n > 100000 ? 100000 : n;
+}
+
+static double time_strict(const char* buf, size_t len) {
+    uint16_t words[MAX_WORDS];
+    size_t words_len;
+    size_t n = iterations_for(len);
+    double start = now_ns();
+    for (size_t i = 0; i < n; i++) {
+        bip39_parse_words(buf, len, MAX_BYTES, MAX_WORD_LEN, words, MAX_WORDS, &words_len);
+    }
+    return (now_ns() - start) / n;
+}
+
+static double time_len(const char* buf, size_t len) {
+    uint16_t words[MAX_WORDS];
+    size_t n = iterations_for(len);
+    double start = now_ns();
+    for (size_t i = 0; i < n; i++) {
+        bip39_words_from_mnemonics_len(buf, len, words, MAX_WORDS);
+    }
+    return (now_ns() - start) / n;
+}
+
+// Scanner inputs: text that looks like logs, valid words back to back (every
+// window reaches the checksum), and uniformly random bytes.
+
+static void fill_log(char* buf, size_t len) {
+    static const char line[] = "2020-06-01T12:00:00Z INFO request served in 12 ms, status 200\n";
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = line[i % (sizeof(line) - 1)];
+    }
+}
+
+static void fill_bip39_words(char* buf, size_t len) {
+    size_t i = 0;
+    while (i < len) {
+        char word[9];
+        bip39_mnemonic_from_word(rand() % 2048, word);
+        for (const char* c = word; *c != '\0' && i < len; c++) {
+            buf[i++] = *c;
+        }
+        if (i < len) {
+            buf[i++] = ' ';
+        }
+    }
+}
+
+static void fill_random(char* buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = rand();
+    }
+}
+
+static const input scan_inputs[] = {
+    { "log lines", fill_log },
+    { "bip39 words", fill_bip39_words },
+    { "random bytes", fill_random },
+};
+
+#define SCAN_LEN (64 * 1024 * 1024)
+#define SCAN_CHUNK_LEN (1024 * 1024)
+
+static void count_phrase(size_t offset, size_t length, const uint16_t* words, size_t words_len, void* user_data) {
+    (*(size_t*)user_data)++;
+}
+
+static double time_scan(const char* buf, size_t len, size_t* phrases) {
+    *phrases = 0;
+    void* scanner = bip39_new_scanner(count_phrase, phrases);
+    double start = now_ns();
+    for (size_t offset = 0; offset < len; offset += SCAN_CHUNK_LEN) {
+        size_t chunk = len - offset < SCAN_CHUNK_LEN ? len - offset : SCAN_CHUNK_LEN;
+        bip39_scan(scanner, (const uint8_t*)buf + offset, chunk);
+    }
+    bip39_finish_scan(scanner);
+    double elapsed = now_ns() - start;
+    bip39_dispose_scanner(scanner);
+    return elapsed;
+}
+
+#define SCAN_FILES 4
+#define SCAN_FILE_LEN (32 * 1024 * 1024)
+
+static void count_file_phrase(size_t path, size_t offset, size_t length, const uint16_t* words, size_t words_len, void* user_data) {
+    (*(size_t*)user_data)++;
+}
+
+// Scans SCAN_FILES log files of SCAN_FILE_LEN bytes on every core.
+static void bench_scan_files(char* buf) {
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    char names[SCAN_FILES][32];
+    const char* paths[SCAN_FILES];
+    fill_log(buf, SCAN_FILE_LEN);
+    for (int i = 0; i < SCAN_FILES; i++) {
+        strcpy(names[i], "/tmp/bc-bip39-bench-XXXXXX");
+        int fd = mkstemp(names[i]);
+        if (fd < 0 || write(fd, buf, SCAN_FILE_LEN) != SCAN_FILE_LEN) {
+            perror("bench");
+            exit(1);
+        }
+        close(fd);
+        paths[i] = names[i];
+    }
+    size_t phrases = 0;
+    double start = now_ns();
+    bip39_scan_files(paths, SCAN_FILES, threads, count_file_phrase, &phrases);
+    double ns = now_ns() - start;
+    printf("%-18s %10zu %14.2f  (%d files, %ld threads)\n", "log files", phrases, (double)SCAN_FILES * SCAN_FILE_LEN / ns, SCAN_FILES, threads);
+    for (int i = 0; i < SCAN_FILES; i++) {
+        unlink(names[i]);
+    }
+}
+
+int main() {
+    static const size_t sizes[] = { 256, 1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024 };
+    size_t max_len = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1];
+    char* buf = malloc(max_len > SCAN_LEN ? max_len : SCAN_LEN);
+
+    printf("limits: %d bytes, %d letters per word, %d words\n\n", MAX_BYTES, MAX_WORD_LEN, MAX_WORDS);
+    printf("%-18s %10s %14s %14s\n", "input", "bytes", "strict ns", "len ns");
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+        for (size_t j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++) {
+            size_t len = sizes[j];
+            inputs[i].fill(buf, len);
+            printf("%-18s %10zu %14.0f %14.0f\n", inputs[i].name, len, time_strict(buf, len), time_len(buf, len));
+        }
+    }
+
+    printf("\nscanner, %d MiB in %d KiB chunks\n\n", SCAN_LEN / (1024 * 1024), SCAN_CHUNK_LEN / 1024);
+    printf("%-18s %10s %14s\n", "input", "phrases", "GB/s");
+    for (size_t i = 0; i < sizeof(scan_inputs) / sizeof(scan_inputs[0]); i++) {
+        scan_inputs[i].fill(buf, SCAN_LEN);
+        size_t phrases;
+        double ns = time_scan(buf, SCAN_LEN, &phrases);
+        printf("%-18s %10zu %14.2f\n", scan_inputs[i].name, phrases, SCAN_LEN / ns);
+    }
+    bench_scan_files(buf);
+    free(buf);
+    return 0;
+}
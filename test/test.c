@@ -6,8 +6,11 @@
 //
 
 #include "../src/bc-bip39.h"
+#include "../src/lookup.h"
 #include "test-utils.h"
 #include <assert.h>
+#include <poll.h>
+#include <unistd.h>
 #include <bc-crypto-base/bc-crypto-base.h>
 #include <stdio.h>
 #include <string.h>
@@ -36,7 +39,7 @@ static void test_mnemonic_from_word() {
 
 bool _test_word_from_mnemonic(const char* s, int16_t expected) {
     int16_t c = bip39_word_from_mnemonic(s);
-    return c == expected;
+    return c == expected && bip39_table_word_from_mnemonic_len(s, strlen(s)) == expected;
 }
 
 static void test_word_from_mnemonic() {
@@ -50,6 +53,9 @@ static void test_word_from_mnemonic() {
     assert(_test_word_from_mnemonic("ley", -1));
     assert(_test_word_from_mnemonic("lengthz", -1));
     assert(_test_word_from_mnemonic("zoot", -1));
+    assert(_test_word_from_mnemonic("xbandon", -1));
+    // No word starts with "fy"; the prefix tables must not run on into "gy".
+    assert(_test_word_from_mnemonic("fym", -1));
 }
 
 static void test_seed_from_string() {
@@ -104,6 +110,45 @@ static bool _test_mnemonics_from_secret(const char* secret_hex, const char* expe
     return result;
 }
 
+static void test_seed_stream() {
+    const char* string = "Hello World";
+    uint8_t expected_seed[BIP39_SEED_LEN];
+    bip39_seed_from_string(string, expected_seed);
+
+    uint8_t seed[BIP39_SEED_LEN];
+    void* stream = bip39_new_seed_stream();
+    bip39_seed_stream_update(stream, (const uint8_t*)"Hello", 5);
+    bip39_seed_stream_update(stream, NULL, 0);
+    bip39_seed_stream_update(stream, (const uint8_t*)" World", 6);
+    bip39_seed_stream_final(stream, seed);
+    assert(memcmp(seed, expected_seed, BIP39_SEED_LEN) == 0);
+    bip39_seed_stream_update(stream, (const uint8_t*)string, strlen(string));
+    bip39_seed_stream_final(stream, seed);
+    assert(memcmp(seed, expected_seed, BIP39_SEED_LEN) == 0);
+    bip39_dispose_seed_stream(stream);
+
+    // More than one read block of dice rolls.
+    size_t rolls_len = 200000;
+    char* rolls = malloc(rolls_len + 1);
+    for (size_t i = 0; i < rolls_len; i++) {
+        rolls[i] = '1' + i * 7 % 6;
+    }
+    rolls[rolls_len] = '\0';
+    bip39_seed_from_string(rolls, expected_seed);
+
+    char path[] = "/tmp/bc-bip39-test-XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    assert(write(fd, rolls, rolls_len) == rolls_len);
+    assert(lseek(fd, 0, SEEK_SET) == 0);
+    assert(bip39_seed_from_fd(fd, seed));
+    assert(memcmp(seed, expected_seed, BIP39_SEED_LEN) == 0);
+    close(fd);
+    unlink(path);
+    assert(!bip39_seed_from_fd(fd, seed));
+    free(rolls);
+}
+
 static void test_mnemonics_from_secret() {
     assert(_test_mnemonics_from_secret("baadf00dbaadf00d", "rival hurdle address inspire tenant alone"));
     assert(_test_mnemonics_from_secret("baadf00dbaadf00dbaadf00dbaadf00d", "rival hurdle address inspire tenant almost turkey safe asset step lab boy"));
@@ -111,6 +156,45 @@ static void test_mnemonics_from_secret() {
     assert(_test_mnemonics_from_secret("7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f", "legal winner thank year wave sausage worth useful legal winner thank yellow"));
 }
 
+static void append_word(size_t index, uint16_t word, const char* mnemonic, void* user_data) {
+    char* phrase = user_data;
+    int16_t expected = bip39_word_from_mnemonic(mnemonic);
+    assert(expected == word);
+    if (index > 0) {
+        strcat(phrase, " ");
+    }
+    strcat(phrase, mnemonic);
+}
+
+static bool _test_emit_words(const char* secret_hex, const char* expected_mnemonics) {
+    uint8_t* secret;
+    size_t secret_len = hex_to_data(secret_hex, &secret);
+    char phrase[300] = "";
+    size_t words_len = bip39_emit_words_from_secret(secret, secret_len, append_word, phrase);
+    free(secret);
+    if (expected_mnemonics == NULL) {
+        return words_len == 0 && phrase[0] == '\0';
+    }
+    return words_len == secret_len * 3 / 4 && strcmp(phrase, expected_mnemonics) == 0;
+}
+
+static void test_emit_words() {
+    assert(_test_emit_words("baadf00dbaadf00d", "rival hurdle address inspire tenant alone"));
+    assert(_test_emit_words("7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f", "legal winner thank year wave sausage worth useful legal winner thank yellow"));
+    assert(_test_emit_words("baadf00dbaadf00dbaadf00dbaadf00dff", NULL));
+    uint8_t secret[32];
+    char expected[300];
+    for (size_t secret_len = 16; secret_len <= 32; secret_len += 4) {
+        for (size_t i = 0; i < secret_len; i++) {
+            secret[i] = 0x9e * (i + secret_len);
+        }
+        char phrase[300] = "";
+        assert(bip39_mnemonics_from_secret(secret, secret_len, expected, sizeof(expected)) > 0);
+        assert(bip39_emit_words_from_secret(secret, secret_len, append_word, phrase) == secret_len * 3 / 4);
+        assert(strcmp(phrase, expected) == 0);
+    }
+}
+
 static bool _test_secret_from_mnemonics(const char* mnemonics, const char* expected_secret_hex) {
     uint8_t* expected_secret;
     size_t expected_secret_len = hex_to_data(expected_secret_hex, &expected_secret);
@@ -132,10 +216,873 @@ static void test_secret_from_mnemonics() {
     assert(_test_secret_from_mnemonics("legal winner thank year wave sausage worth useful legal winner thank yellow", "7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f"));
 }
 
+static void test_length_delimited() {
+    // Slices of a larger buffer; nothing past each slice may be read.
+    const char buf[] = "xxlegal winner thank year wave sausage worth useful legal winner thank yellowzz";
+    const char* phrase = buf + 2;
+    size_t phrase_len = sizeof(buf) - 1 - 4;
+
+    assert(bip39_word_from_mnemonic_len(phrase, 5) == 1019);
+    assert(bip39_word_from_mnemonic_len(phrase, 3) == 1018);
+    assert(bip39_word_from_mnemonic_len(phrase, 4) == -1);
+    assert(bip39_word_from_mnemonic_len(phrase, 6) == -1);
+    assert(bip39_word_from_mnemonic_len("leg\0l", 5) == -1);
+
+    uint16_t words[12];
+    assert(bip39_words_from_mnemonics_len(phrase, phrase_len, words, 12) == 12);
+    assert(words[0] == 1019 && words[11] == 2040);
+    assert(bip39_words_from_mnemonics_len(phrase, phrase_len + 2, words, 12) == 0);
+
+    uint8_t secret[32];
+    assert(bip39_secret_from_mnemonics_len(phrase, phrase_len, secret, sizeof(secret)) == 16);
+    for (int i = 0; i < 16; i++) {
+        assert(secret[i] == 0x7f);
+    }
+    assert(bip39_secret_from_mnemonics_len(phrase, phrase_len - 1, secret, sizeof(secret)) == 0);
+
+    // Overlong tokens are rejected rather than truncated.
+    assert(bip39_words_from_mnemonics("abandonabandonabandonabandonabandon about", words, 12) == 0);
+}
+
+static void test_strict_parse() {
+    const char* p = "legal winner thank year wave sausage worth useful legal winner thank yellow";
+    uint16_t words[24];
+    uint8_t secret[32];
+    size_t len;
+    assert(bip39_parse_words(p, strlen(p), 1024, 8, words, 24, &len) == BIP39_PARSE_OK);
+    assert(len == 12 && words[0] == 1019 && words[11] == 2040);
+    assert(bip39_parse_secret(p, strlen(p), 1024, 8, secret, &len) == BIP39_PARSE_OK);
+    assert(len == 16 && secret[0] == 0x7f);
+
+    assert(bip39_parse_words(p, strlen(p), 20, 8, words, 24, &len) == BIP39_PARSE_TOO_LONG && len == 0);
+    assert(bip39_parse_words(p, strlen(p), 1024, 6, words, 24, &len) == BIP39_PARSE_WORD_TOO_LONG && len == 0);
+    assert(bip39_parse_words(p, strlen(p), 1024, 8, words, 11, &len) == BIP39_PARSE_TOO_MANY_WORDS && len == 0);
+    assert(bip39_parse_words(" \n\t", 3, 1024, 8, words, 24, &len) == BIP39_PARSE_EMPTY);
+
+    // Tokens longer than any word are unknown whatever the limit.
+    const char* q = "legal winnerwinner thank";
+    assert(bip39_parse_words(q, strlen(q), 1024, 100, words, 24, &len) == BIP39_PARSE_UNKNOWN_WORD);
+    const char* r = "legal winner thank";
+    assert(bip39_parse_words(r, strlen(r), 1024, 8, words, 24, &len) == BIP39_PARSE_OK && len == 3);
+    assert(bip39_parse_secret(r, strlen(r), 1024, 8, secret, &len) == BIP39_PARSE_BAD_LENGTH && len == 0);
+    const char* c = "legal winner thank year wave sausage worth useful legal winner thank thank";
+    assert(bip39_parse_secret(c, strlen(c), 1024, 8, secret, &len) == BIP39_PARSE_BAD_CHECKSUM && len == 0);
+}
+
+static void test_abbreviations() {
+    for (uint16_t i = 0; i < 2048; i++) {
+        char mnemonic[20];
+        bip39_mnemonic_from_word(i, mnemonic);
+        assert(bip39_word_from_abbreviation(mnemonic) == i);
+        mnemonic[4] = '\0';
+        assert(bip39_word_from_abbreviation(mnemonic) == i);
+    }
+    assert(bip39_word_from_abbreviation("leg") == 1018);
+    assert(bip39_word_from_abbreviation("lega") == 1019);
+    assert(bip39_word_from_abbreviation("legal") == 1019);
+    assert(bip39_word_from_abbreviation("legax") == -1);
+    assert(bip39_word_from_abbreviation("aba") == -1);
+    assert(bip39_word_from_abbreviation("ab") == -1);
+    assert(bip39_word_from_abbreviation("zzzz") == -1);
+    assert(bip39_word_from_abbreviation("LEGA") == -1);
+
+    const char* abbreviated = "lega winn than year wave saus wort usef lega winn than yell";
+    uint16_t words[12];
+    assert(bip39_words_from_abbreviated_mnemonics(abbreviated, words, 12) == 12);
+    assert(words[0] == 1019 && words[11] == 2040);
+    assert(bip39_words_from_mnemonics(abbreviated, words, 12) == 0);
+
+    uint8_t secret[32];
+    assert(bip39_secret_from_abbreviated_mnemonics(abbreviated, secret, sizeof(secret)) == 16);
+    for (int i = 0; i < 16; i++) {
+        assert(secret[i] == 0x7f);
+    }
+    assert(bip39_secret_from_abbreviated_mnemonics("legal winn thank year wave sausage wort useful lega winner than yellow", secret, sizeof(secret)) == 16);
+    assert(bip39_secret_from_abbreviated_mnemonics("lega winn than year wave saus wort usef lega winn than yello", secret, sizeof(secret)) == 0);
+}
+
+static void test_constant_time_lookup() {
+    for (uint16_t i = 0; i < 2048; i++) {
+        char mnemonic[20];
+        bip39_mnemonic_from_word(i, mnemonic);
+        assert(bip39_word_from_mnemonic_constant_time(mnemonic, strlen(mnemonic)) == i);
+    }
+    assert(bip39_word_from_mnemonic_constant_time("abandon", 7) == 0);
+    assert(bip39_word_from_mnemonic_constant_time("zoo", 3) == 2047);
+    assert(bip39_word_from_mnemonic_constant_time("legalx", 5) == 1019);
+    assert(bip39_word_from_mnemonic_constant_time("lega", 4) == -1);
+    assert(bip39_word_from_mnemonic_constant_time("leg\0\0", 5) == -1);
+    assert(bip39_word_from_mnemonic_constant_time("", 0) == -1);
+    assert(bip39_word_from_mnemonic_constant_time("abandonab", 9) == -1);
+    assert(bip39_word_from_mnemonic_constant_time(NULL, 3) == -1);
+}
+
+static void test_seedqr() {
+    const char* phrase = "legal winner thank year wave sausage worth useful legal winner thank yellow";
+    const char* expected_digits = "101920151790203919831533203119191019201517902040";
+    uint16_t words[24];
+    assert(bip39_words_from_mnemonics(phrase, words, 24) == 12);
+
+    char digits[97];
+    assert(bip39_seedqr_from_words(words, 12, digits, sizeof(digits)) == 48);
+    assert(strcmp(digits, expected_digits) == 0);
+    assert(bip39_seedqr_from_words(words, 12, digits, 48) == 0);
+
+    uint16_t decoded[24];
+    assert(bip39_words_from_seedqr(expected_digits, 48, decoded, 24) == 12);
+    assert(memcmp(decoded, words, 12 * sizeof(uint16_t)) == 0);
+    assert(bip39_words_from_seedqr(expected_digits, 47, decoded, 24) == 0);
+    assert(bip39_words_from_seedqr("101920151790203919831533203119191019201517902041", 48, decoded, 24) == 0);
+    assert(bip39_words_from_seedqr("10192015179020391983153320311919101920151790204a", 48, decoded, 24) == 0);
+    assert(bip39_words_from_seedqr("999920151790203919831533203119191019201517902040", 48, decoded, 24) == 0);
+
+    uint8_t bytes[32];
+    assert(bip39_compact_seedqr_from_words(words, 12, bytes, sizeof(bytes)) == 16);
+    for (int i = 0; i < 16; i++) {
+        assert(bytes[i] == 0x7f);
+    }
+    assert(bip39_words_from_compact_seedqr(bytes, 16, decoded, 24) == 12);
+    assert(memcmp(decoded, words, 12 * sizeof(uint16_t)) == 0);
+    assert(bip39_words_from_compact_seedqr(bytes, 15, decoded, 24) == 0);
+
+    // Three records, the middle one with a bad checksum.
+    uint16_t batch_words[3 * 12];
+    for (int i = 0; i < 3; i++) {
+        memcpy(batch_words + i * 12, words, 12 * sizeof(uint16_t));
+    }
+    batch_words[12 + 11] ^= 1;
+    char batch_digits[3 * 48];
+    bool valid[3];
+    assert(bip39_seedqr_from_words_batch(batch_words, 12, 3, batch_digits, valid) == 2);
+    assert(valid[0] && !valid[1] && valid[2]);
+    assert(memcmp(batch_digits + 2 * 48, expected_digits, 48) == 0);
+    memcpy(batch_digits + 48, expected_digits, 48);
+    uint16_t batch_decoded[3 * 12];
+    assert(bip39_words_from_seedqr_batch(batch_digits, 12, 3, batch_decoded, NULL) == 3);
+    assert(memcmp(batch_decoded + 12, words, 12 * sizeof(uint16_t)) == 0);
+
+    uint8_t batch_bytes[3 * 16];
+    assert(bip39_compact_seedqr_from_words_batch(batch_words, 12, 3, batch_bytes, valid) == 2);
+    assert(!valid[1] && batch_bytes[16] == 0 && batch_bytes[32] == 0x7f);
+    assert(bip39_words_from_compact_seedqr_batch(batch_bytes, 16, 3, batch_decoded) == 3);
+    assert(memcmp(batch_decoded + 24, words, 12 * sizeof(uint16_t)) == 0);
+}
+
+static void test_kway_search() {
+    void* ctx = bip39_new_context();
+    uint16_t target = 1018;
+    size_t steps = 0;
+
+    bip39_start_kway_search(ctx, 4);
+    while (!bip39_done_search(ctx)) {
+        uint8_t branch = 0;
+        while (bip39_kway_branch_start(ctx, branch + 1) <= target) {
+            branch++;
+        }
+        bip39_choose_kway(ctx, branch);
+        steps++;
+    }
+    assert(bip39_selected_word(ctx) == target);
+    assert(steps == 6);
+
+    bip39_dispose_context(ctx);
+}
+
+static void test_keypad_search() {
+    void* ctx = bip39_new_context();
+
+    bip39_start_keypad_search(ctx);
+    assert(bip39_keypad_candidate_count(ctx) == 2048);
+    assert(!bip39_keypad_press(ctx, '1'));
+    assert(bip39_keypad_press(ctx, '5'));
+    assert(bip39_keypad_press(ctx, '3'));
+    assert(bip39_keypad_press(ctx, '4'));
+
+    size_t count = bip39_keypad_candidate_count(ctx);
+    bool found_leg = false;
+    for (size_t i = 0; i < count; i++) {
+        char mnemonic[20];
+        bip39_mnemonic_from_word(bip39_keypad_candidate(ctx, i), mnemonic);
+        assert(strlen(mnemonic) >= 3);
+        assert(strchr("jkl", mnemonic[0]) && strchr("def", mnemonic[1]) && strchr("ghi", mnemonic[2]));
+        found_leg = found_leg || strcmp(mnemonic, "leg") == 0;
+    }
+    assert(found_leg);
+    assert(bip39_keypad_candidate(ctx, count) == 0xFFFF);
+
+    bip39_start_keypad_search(ctx);
+    for (const char* p = "536484"; *p != '\0'; p++) {
+        assert(bip39_keypad_press(ctx, *p));
+    }
+    assert(bip39_keypad_candidate_count(ctx) == 1);
+    assert(bip39_keypad_candidate(ctx, 0) == 1024);
+    assert(!bip39_keypad_press(ctx, '2'));
+
+    bip39_dispose_context(ctx);
+}
+
+static void _test_valid_final_words(size_t words_len, size_t expected_len, uint16_t expected_word) {
+    uint16_t words[24] = { 0 };
+    uint16_t final_words[128];
+    size_t final_words_len = bip39_valid_final_words(words, words_len, final_words, 128);
+    assert(final_words_len == expected_len);
+
+    bool found = false;
+    void* ctx = bip39_new_context();
+    bip39_set_word_count(ctx, words_len + 1);
+    for (size_t i = 0; i < final_words_len; i++) {
+        bip39_clear(ctx);
+        bip39_set_word(ctx, words_len, final_words[i]);
+        assert(bip39_verify_checksum(ctx));
+        found = found || final_words[i] == expected_word;
+    }
+    bip39_dispose_context(ctx);
+    assert(found);
+}
+
+static void test_valid_final_words() {
+    // "abandon abandon ... about" and "abandon abandon ... art"
+    _test_valid_final_words(11, 128, 3);
+    _test_valid_final_words(23, 8, 102);
+    assert(bip39_valid_final_words(NULL, 12, NULL, 0) == 0);
+}
+
+typedef struct {
+    size_t count;
+    size_t offsets[4];
+    size_t lengths[4];
+    size_t words_lens[4];
+} scan_results;
+
+static void scan_callback(size_t offset, size_t length, const uint16_t* words, size_t words_len, void* user_data) {
+    scan_results* results = user_data;
+    assert(results->count < 4);
+    results->offsets[results->count] = offset;
+    results->lengths[results->count] = length;
+    results->words_lens[results->count] = words_len;
+    results->count++;
+}
+
+static void test_scan() {
+    const char* text =
+        "2020-01-01 INFO seed=\"Legal winner thank year wave sausage worth useful legal winner thank yellow\"\n"
+        "noise legal winner thank year wave sausage worth useful legal winner thank\n"
+        "1. abandon 2. abandon 3. abandon 4. abandon 5. abandon 6. abandon 7. abandon 8. abandon "
+        "9. abandon 10. abandon 11. abandon 12. abandon 13. abandon 14. abandon 15. abandon 16. abandon "
+        "17. abandon 18. abandon 19. abandon 20. abandon 21. abandon 22. abandon 23. abandon 24. art";
+    size_t text_len = strlen(text);
+
+    scan_results results = { 0 };
+    void* scanner = bip39_new_scanner(scan_callback, &results);
+    // Split the stream in the middle of a word.
+    bip39_scan(scanner, (const uint8_t*)text, 30);
+    bip39_scan(scanner, (const uint8_t*)text + 30, text_len - 30);
+    bip39_finish_scan(scanner);
+    bip39_dispose_scanner(scanner);
+
+    assert(results.count == 2);
+    assert(results.words_lens[0] == 12);
+    assert(results.offsets[0] == strstr(text, "Legal") - text);
+    assert(results.lengths[0] == strstr(text, "yellow") + 6 - text - results.offsets[0]);
+    assert(results.words_lens[1] == 24);
+    assert(results.offsets[1] == strstr(text, "abandon") - text);
+    assert(results.offsets[1] + results.lengths[1] == text_len);
+}
+
+typedef struct {
+    size_t count;
+    size_t paths[4];
+    size_t offsets[4];
+} file_scan_results;
+
+static void scan_file_callback(size_t path, size_t offset, size_t length, const uint16_t* words, size_t words_len, void* user_data) {
+    file_scan_results* results = user_data;
+    assert(results->count < 4 && words_len == 12);
+    results->paths[results->count] = path;
+    results->offsets[results->count] = offset;
+    results->count++;
+}
+
+static void test_scan_files() {
+    const char* texts[2] = {
+        "nothing to see here\n",
+        "log: Legal winner thank year wave sausage worth useful legal winner thank yellow\n",
+    };
+    char names[2][32];
+    for (int i = 0; i < 2; i++) {
+        strcpy(names[i], "/tmp/bc-bip39-test-XXXXXX");
+        int fd = mkstemp(names[i]);
+        assert(fd >= 0);
+        assert(write(fd, texts[i], strlen(texts[i])) == strlen(texts[i]));
+        close(fd);
+    }
+    const char* paths[3] = { names[0], "/nonexistent/bc-bip39-test", names[1] };
+    file_scan_results results = { 0 };
+    assert(bip39_scan_files(paths, 3, 2, scan_file_callback, &results) == 1);
+    assert(results.count == 1 && results.paths[0] == 2 && results.offsets[0] == 5);
+    for (int i = 0; i < 2; i++) {
+        unlink(names[i]);
+    }
+}
+
+static void test_generate() {
+    uint16_t words[24];
+    assert(bip39_generate_words(16, words, 24) == 12);
+    assert(bip39_generate_words(15, words, 24) == 0);
+
+    char mnemonics[300];
+    size_t mnemonics_len = bip39_generate_mnemonics(32, mnemonics, sizeof(mnemonics));
+    assert(mnemonics_len > 0 && mnemonics_len == strlen(mnemonics));
+    uint8_t secret[32];
+    assert(bip39_secret_from_mnemonics(mnemonics, secret, sizeof(secret)) == 32);
+
+    // Larger than one entropy block, so the batch spans several reads.
+    size_t count = 1000;
+    uint16_t* batch = alloc_uint16_buffer(count * 24, 0xFFFF);
+    assert(bip39_generate_words_batch(32, count, batch) == count);
+    void* ctx = bip39_new_context();
+    bip39_set_word_count(ctx, 24);
+    for (size_t i = 0; i < count; i++) {
+        for (size_t j = 0; j < 24; j++) {
+            assert(batch[i * 24 + j] < 2048);
+            bip39_set_word(ctx, j, batch[i * 24 + j]);
+        }
+        assert(bip39_verify_checksum(ctx));
+    }
+    assert(memcmp(batch, batch + 24, 24 * sizeof(uint16_t)) != 0);
+    bip39_dispose_context(ctx);
+    free(batch);
+}
+
+static void test_seed_from_mnemonics() {
+    uint8_t seed[BIP39_MNEMONIC_SEED_LEN];
+    assert(bip39_seed_from_mnemonics("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about", "TREZOR", seed));
+    uint8_t* expected_seed;
+    size_t expected_seed_len = hex_to_data("c55257c360c07c72029aebc1b53c05ed0362ada38ead3e3e9efa3708e53495531f09a6987599d18264c1e1c92f2cf141630c7a3c4ab7c81b2f001698e7463b04", &expected_seed);
+    assert(equal_uint8_buffers(seed, BIP39_MNEMONIC_SEED_LEN, expected_seed, expected_seed_len));
+    free(expected_seed);
+}
+
+typedef struct {
+    size_t ok;
+    size_t cancelled;
+    uint8_t seed[BIP39_MNEMONIC_SEED_LEN];
+} seed_results;
+
+static void seed_callback(uint64_t job_id, int status, const uint8_t* seed, void* user_data) {
+    seed_results* results = user_data;
+    if (status == BIP39_SEED_OK) {
+        memcpy(results->seed, seed, BIP39_MNEMONIC_SEED_LEN);
+        results->ok++;
+    } else {
+        assert(seed == NULL);
+        results->cancelled++;
+    }
+}
+
+static void test_master_key() {
+    const char* phrase = "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about";
+    uint8_t master_key[BIP39_MASTER_KEY_LEN];
+    assert(bip39_master_key_from_mnemonics(phrase, strlen(phrase), "TREZOR", master_key));
+    uint8_t* expected_key;
+    size_t expected_key_len = hex_to_data("cbedc75b0d6412c85c79bc13875112ef912fd1e756631b5a00330866f22ff184a3fa8c983223306de0f0f65e74ebb1e98aba751633bf91d5fb56529aa5c132c1", &expected_key);
+    assert(equal_uint8_buffers(master_key, BIP39_MASTER_KEY_LEN, expected_key, expected_key_len));
+
+    // Separators are normalized, and long passphrases take the streaming path.
+    const char* spaced = "  abandon\tabandon abandon abandon abandon abandon abandon abandon abandon abandon abandon,about\n";
+    assert(bip39_master_key_from_mnemonics(spaced + 2, strlen(spaced + 2), "TREZOR", master_key));
+    assert(equal_uint8_buffers(master_key, BIP39_MASTER_KEY_LEN, expected_key, expected_key_len));
+
+    char long_passphrase[301];
+    memset(long_passphrase, 'x', 300);
+    long_passphrase[300] = '\0';
+    uint8_t seed[BIP39_MNEMONIC_SEED_LEN];
+    uint8_t expected_master_key[BIP39_MASTER_KEY_LEN];
+    assert(bip39_seed_from_mnemonics(phrase, long_passphrase, seed));
+    hmac_sha512((const uint8_t*)"Bitcoin seed", 12, seed, sizeof(seed), expected_master_key);
+    assert(bip39_master_key_from_mnemonics(phrase, strlen(phrase), long_passphrase, master_key));
+    assert(memcmp(master_key, expected_master_key, BIP39_MASTER_KEY_LEN) == 0);
+
+    assert(!bip39_master_key_from_mnemonics(phrase, strlen(phrase) - 1, "TREZOR", master_key));
+    assert(!bip39_master_key_from_mnemonics("abandon abandon abandon", 23, NULL, master_key));
+
+    const char* phrases[5] = { phrase, "legal winner", phrase, spaced + 2, phrase };
+    const char* passphrases[5] = { "TREZOR", "", "TREZOR", "TREZOR", "TREZOR" };
+    uint8_t master_keys[5 * BIP39_MASTER_KEY_LEN];
+    bool valid[5];
+    assert(bip39_master_keys_from_mnemonics(phrases, passphrases, 5, 3, master_keys, valid) == 4);
+    for (int i = 0; i < 5; i++) {
+        assert(valid[i] == (i != 1));
+        if (valid[i]) {
+            assert(equal_uint8_buffers(master_keys + i * BIP39_MASTER_KEY_LEN, BIP39_MASTER_KEY_LEN, expected_key, expected_key_len));
+        }
+    }
+    free(expected_key);
+}
+
+static void test_bip85() {
+    // The BIP85 test master key.
+    uint8_t* master_key;
+    hex_to_data("3f15e5d852dc2e9ba5e9fe189a8dd2e1547badef5b563bbe6579fc6807d80ed91b67969d1ec69bdfeeae43213da8460ba34b92d0788c8f7bfcfa44906e8a589c", &master_key);
+
+    char mnemonics[300];
+    assert(bip39_bip85_mnemonics(master_key, 12, 0, mnemonics, sizeof(mnemonics)) == 71);
+    assert(strcmp(mnemonics, "girl mad pet galaxy egg matter matrix prison refuse sense ordinary nose") == 0);
+    assert(bip39_bip85_mnemonics(master_key, 18, 0, mnemonics, sizeof(mnemonics)) > 0);
+    assert(strcmp(mnemonics, "near account window bike charge season chef number sketch tomorrow excuse sniff circle vital hockey outdoor supply token") == 0);
+    assert(bip39_bip85_mnemonics(master_key, 24, 0, mnemonics, sizeof(mnemonics)) > 0);
+    assert(strcmp(mnemonics, "puppy ocean match cereal symbol another shed magic wrap hammer bulb intact gadget divorce twin tonight reason outdoor destroy simple truth cigar social volcano") == 0);
+    assert(bip39_bip85_mnemonics(master_key, 12, 0, mnemonics, 71) == 0);
+    assert(bip39_bip85_mnemonics(master_key, 15, 0, mnemonics, sizeof(mnemonics)) == 0);
+
+    uint16_t words[6 * 12];
+    assert(bip39_bip85_words_batch(master_key, 12, 0, 6, words) == 6);
+    uint16_t one[12];
+    assert(bip39_bip85_words(master_key, 12, 1, one) == 12);
+    assert(memcmp(one, words + 12, sizeof(one)) == 0);
+    assert(bip39_bip85_words(master_key, 12, 5, one) == 12);
+    assert(memcmp(one, words + 5 * 12, sizeof(one)) == 0);
+    char mnemonic[20];
+    bip39_mnemonic_from_word(one[0], mnemonic);
+    assert(strcmp(mnemonic, "pledge") == 0);
+
+    assert(bip39_bip85_words(master_key, 12, 0x80000000, one) == 0);
+    free(master_key);
+}
+
+typedef struct order_search_t {
+    const uint16_t* expected;
+    size_t found;
+    bool seen_expected;
+    size_t progress_calls;
+    size_t stop_after;
+} order_search;
+
+static bool on_order(const uint16_t* words, size_t words_len, void* user_data) {
+    order_search* o = user_data;
+    o->found++;
+    if (memcmp(words, o->expected, words_len * sizeof(uint16_t)) == 0) {
+        o->seen_expected = true;
+    }
+    return false;
+}
+
+static bool on_order_progress(uint64_t resume_unit, uint64_t units_len, void* user_data) {
+    order_search* o = user_data;
+    assert(resume_unit <= units_len);
+    o->progress_calls++;
+    return o->progress_calls != o->stop_after;
+}
+
+static void test_recover_order() {
+    const char* p = "legal winner thank year wave sausage worth useful legal winner thank yellow";
+    uint16_t expected[12];
+    assert(bip39_words_from_mnemonics(p, expected, 12) == 12);
+
+    // Eight positions are known, so 4! orders of the rest are tried.
+    uint16_t shuffled[12];
+    for (size_t i = 0; i < 12; i++) {
+        shuffled[i] = expected[11 - i];
+    }
+    uint16_t fixed[12];
+    for (size_t i = 0; i < 12; i++) {
+        fixed[i] = i % 2 == 0 || i > 8 ? expected[i] : BIP39_ORDER_ANY;
+    }
+    uint64_t units = bip39_order_units(shuffled, 12, fixed);
+    assert(units > 1);
+
+    order_search all = { expected };
+    assert(bip39_recover_order(shuffled, 12, fixed, 4, 0, on_order, on_order_progress, &all) == units);
+    assert(all.seen_expected && all.found > 0);
+    assert(all.progress_calls == units);
+
+    // Stopping and resuming covers the same orders.
+    order_search first = { expected, 0, false, 0, 3 };
+    uint64_t resume = bip39_recover_order(shuffled, 12, fixed, 1, 0, on_order, on_order_progress, &first);
+    assert(resume == 3);
+    order_search rest = { expected };
+    assert(bip39_recover_order(shuffled, 12, fixed, 2, resume, on_order, NULL, &rest) == units);
+    assert(first.found + rest.found == all.found);
+    assert(first.seen_expected || rest.seen_expected);
+
+    // A fixed word missing from the set.
+    fixed[0] = (expected[0] + 1) % 2048;
+    assert(bip39_order_units(shuffled, 12, fixed) == 0);
+    assert(bip39_recover_order(shuffled, 12, fixed, 1, 0, on_order, NULL, &rest) == 0);
+
+    // Written down a 3x4 grid by columns, read back by rows.
+    uint16_t by_rows[12];
+    for (size_t r = 0; r < 3; r++) {
+        for (size_t c = 0; c < 4; c++) {
+            by_rows[r * 4 + c] = expected[c * 3 + r];
+        }
+    }
+    order_search layout = { expected };
+    assert(bip39_recover_layout(by_rows, 12, NULL, on_order, &layout) > 0);
+    assert(layout.seen_expected);
+}
+
+static void test_seed_queue() {
+    const char* mnemonics = "legal winner thank year wave sausage worth useful legal winner thank yellow";
+    uint8_t expected_seed[BIP39_MNEMONIC_SEED_LEN];
+    bip39_seed_from_mnemonics(mnemonics, "TREZOR", expected_seed);
+
+    seed_results results = { 0 };
+    void* queue = bip39_new_seed_queue(1, 4);
+    uint64_t ids[4];
+    for (int i = 0; i < 4; i++) {
+        ids[i] = bip39_submit_seed(queue, mnemonics, "TREZOR", seed_callback, &results);
+        assert(ids[i] != 0);
+    }
+    assert(bip39_submit_seed(queue, mnemonics, "TREZOR", seed_callback, &results) == 0);
+    assert(bip39_cancel_seed(queue, ids[3]));
+    assert(!bip39_cancel_seed(queue, 12345));
+
+    struct pollfd pfd = { bip39_seed_queue_fd(queue), POLLIN, 0 };
+    size_t delivered = 0;
+    while (delivered < 4) {
+        assert(poll(&pfd, 1, 10000) == 1);
+        delivered += bip39_poll_seeds(queue, 4);
+    }
+    assert(results.ok == 3);
+    assert(results.cancelled == 1);
+    assert(memcmp(results.seed, expected_seed, BIP39_MNEMONIC_SEED_LEN) == 0);
+
+    // Delivered jobs free their slots.
+    uint64_t id = bip39_submit_seed(queue, mnemonics, NULL, seed_callback, &results);
+    assert(id > ids[3]);
+    bip39_dispose_seed_queue(queue);
+}
+
+static void test_seed_cache() {
+    const char* a = "legal winner thank year wave sausage worth useful legal winner thank yellow";
+    const char* b = "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about";
+    uint8_t expected_seed[BIP39_MNEMONIC_SEED_LEN];
+    uint8_t seed[BIP39_MNEMONIC_SEED_LEN];
+    bip39_seed_from_mnemonics(a, "TREZOR", expected_seed);
+
+    void* cache = bip39_new_seed_cache(2, 0);
+    assert(!bip39_cached_seed_from_mnemonics(cache, a, "TREZOR", seed));
+    assert(memcmp(seed, expected_seed, BIP39_MNEMONIC_SEED_LEN) == 0);
+    memset(seed, 0, sizeof(seed));
+    assert(bip39_cached_seed_from_mnemonics(cache, a, "TREZOR", seed));
+    assert(memcmp(seed, expected_seed, BIP39_MNEMONIC_SEED_LEN) == 0);
+
+    // The passphrase is part of the key.
+    assert(!bip39_cached_seed_from_mnemonics(cache, a, NULL, seed));
+    assert(memcmp(seed, expected_seed, BIP39_MNEMONIC_SEED_LEN) != 0);
+
+    // Least recently used goes first: `a` with TREZOR was used before `a`
+    // alone, so adding `b` evicts it.
+    assert(!bip39_cached_seed_from_mnemonics(cache, b, "TREZOR", seed));
+    assert(bip39_cached_seed_from_mnemonics(cache, a, "", seed));
+    assert(!bip39_cached_seed_from_mnemonics(cache, a, "TREZOR", seed));
+    assert(memcmp(seed, expected_seed, BIP39_MNEMONIC_SEED_LEN) == 0);
+
+    uint64_t hits, misses;
+    size_t entries;
+    bip39_seed_cache_stats(cache, &hits, &misses, &entries);
+    assert(hits == 2 && misses == 4 && entries == 2);
+
+    bip39_clear_seed_cache(cache);
+    bip39_seed_cache_stats(cache, NULL, NULL, &entries);
+    assert(entries == 0);
+    bip39_dispose_seed_cache(cache);
+
+    // An expired entry is wiped even if it was used more recently than a
+    // live one.
+    cache = bip39_new_seed_cache(3, 1);
+    assert(!bip39_cached_seed_from_mnemonics(cache, a, "TREZOR", seed));
+    usleep(500000);
+    assert(!bip39_cached_seed_from_mnemonics(cache, b, "TREZOR", seed));
+    assert(bip39_cached_seed_from_mnemonics(cache, a, "TREZOR", seed));
+    usleep(600000);
+    bip39_seed_cache_stats(cache, NULL, NULL, &entries);
+    assert(entries == 1);
+    assert(bip39_cached_seed_from_mnemonics(cache, b, "TREZOR", seed));
+    bip39_dispose_seed_cache(cache);
+}
+
+static void add_numbered_phrase(void* set, uint32_t n, uint64_t id) {
+    uint8_t secret[16] = { 0 };
+    secret[0] = n >> 8;
+    secret[1] = n;
+    char mnemonics[300];
+    size_t mnemonics_len = bip39_mnemonics_from_secret(secret, sizeof(secret), mnemonics, sizeof(mnemonics));
+    assert(bip39_entropy_set_add(set, mnemonics, mnemonics_len, id));
+}
+
+typedef struct groups_t {
+    size_t count;
+    uint64_t sum;
+} groups;
+
+static void check_duplicate(const uint64_t* ids_a, size_t ids_a_len, const uint64_t* ids_b, size_t ids_b_len, void* user_data) {
+    groups* g = user_data;
+    assert(ids_a_len == 2 && ids_b_len == 0);
+    assert(ids_a[0] % 200 == ids_a[1] % 200 && ids_a[0] != ids_a[1]);
+    g->count++;
+    g->sum += ids_a[0] % 200;
+}
+
+static void check_shared(const uint64_t* ids_a, size_t ids_a_len, const uint64_t* ids_b, size_t ids_b_len, void* user_data) {
+    groups* g = user_data;
+    assert(ids_b_len == 1 && ids_b[0] >= 150 && ids_b[0] < 200);
+    for (size_t i = 0; i < ids_a_len; i++) {
+        assert(ids_a[i] % 200 == ids_b[0]);
+    }
+    g->count++;
+    g->sum += ids_b[0];
+}
+
+static void check_any(const uint64_t* ids_a, size_t ids_a_len, const uint64_t* ids_b, size_t ids_b_len, void* user_data) {
+    assert(ids_a_len == 2 && ids_a[0] + ids_a[1] == 3);
+}
+
+static void test_entropy_set() {
+    // A 4 KiB budget holds about 50 records, so both sets spill several runs.
+    void* a = bip39_new_entropy_set(4096, 3, NULL);
+    void* b = bip39_new_entropy_set(4096, 1, NULL);
+    for (uint32_t i = 0; i < 300; i++) {
+        add_numbered_phrase(a, i % 200, i);
+    }
+    for (uint32_t i = 150; i < 350; i++) {
+        add_numbered_phrase(b, i, i);
+    }
+
+    groups g = { 0 };
+    assert(bip39_find_duplicates(a, check_duplicate, &g) == 100);
+    assert(g.count == 100 && g.sum == 99 * 100 / 2);
+    g.count = g.sum = 0;
+    assert(bip39_find_shared(a, b, check_shared, &g) == 50);
+    assert(g.count == 50 && g.sum == (150 + 199) * 50 / 2);
+
+    // Case and spacing don't matter; invalid phrases are rejected.
+    const char* p = "legal winner thank year wave sausage worth useful legal winner thank yellow";
+    const char* q = "  LEGAL Winner thank year wave sausage\nworth useful legal winner thank yellow ";
+    const char* r = "legal winner thank year wave sausage worth useful legal winner thank thank";
+    void* c = bip39_new_entropy_set(0, 0, NULL);
+    assert(bip39_entropy_set_add(c, p, strlen(p), 1));
+    assert(bip39_entropy_set_add(c, q, strlen(q), 2));
+    assert(!bip39_entropy_set_add(c, r, strlen(r), 3));
+    assert(bip39_find_duplicates(c, check_any, NULL) == 1);
+    assert(bip39_find_duplicates(b, check_any, NULL) == 0);
+    assert(bip39_entropy_set_ok(a) && bip39_entropy_set_ok(c));
+
+    bip39_dispose_entropy_set(a);
+    bip39_dispose_entropy_set(b);
+    bip39_dispose_entropy_set(c);
+}
+
+static void test_wordlist_image() {
+    size_t image_len = bip39_wordlist_write_image(NULL, NULL, 0);
+    uint8_t* image = alloc_uint8_buffer(image_len, 0);
+    assert(bip39_wordlist_write_image(NULL, image, image_len) == image_len);
+
+    void* wordlist = bip39_wordlist_from_image(image, image_len);
+    assert(wordlist != NULL);
+    for (uint16_t i = 0; i < 2048; i++) {
+        char mnemonic[20];
+        bip39_mnemonic_from_word(i, mnemonic);
+        assert(strcmp(bip39_wordlist_get_mnemonic(wordlist, i), mnemonic) == 0);
+        assert(bip39_wordlist_word_from_mnemonic(wordlist, mnemonic) == i);
+    }
+    assert(bip39_wordlist_get_mnemonic(wordlist, 2048) == NULL);
+    assert(bip39_wordlist_word_from_mnemonic(wordlist, "lengthz") == -1);
+    assert(bip39_wordlist_word_from_mnemonic(wordlist, "le") == -1);
+    assert(bip39_wordlist_word_from_mnemonic_len(wordlist, "legal", 3) == 1018);
+    // "zoo" is the last word in the blob; the NUL must not match past it.
+    assert(bip39_wordlist_word_from_mnemonic_len(wordlist, "zoo\0", 4) == -1);
+    bip39_wordlist_close(wordlist);
+
+    char path[] = "/tmp/bc-bip39-test-XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    assert(write(fd, image, image_len) == image_len);
+    close(fd);
+    wordlist = bip39_wordlist_open(path);
+    assert(wordlist != NULL);
+    assert(bip39_wordlist_word_from_mnemonic(wordlist, "zoo") == 2047);
+    bip39_wordlist_close(wordlist);
+    unlink(path);
+
+    assert(bip39_wordlist_from_image(image, image_len - 1) == NULL);
+    image[0] = 'X';
+    assert(bip39_wordlist_from_image(image, image_len) == NULL);
+    free(image);
+
+    const char* duplicates[2048];
+    for (int i = 0; i < 2048; i++) {
+        duplicates[i] = "same";
+    }
+    image_len = bip39_wordlist_write_image(duplicates, NULL, 0);
+    image = alloc_uint8_buffer(image_len, 0);
+    assert(bip39_wordlist_write_image(duplicates, image, image_len) == 0);
+    free(image);
+}
+
+static void test_detect_wordlist() {
+    // English, English reversed, and a list sharing no words with English.
+    static char english_words[2048][9];
+    static char other_words[2048][10];
+    const char* english[2048];
+    const char* reversed[2048];
+    const char* other[2048];
+    for (uint16_t i = 0; i < 2048; i++) {
+        bip39_mnemonic_from_word(i, english_words[i]);
+        english[i] = english_words[i];
+        reversed[2047 - i] = english[i];
+        snprintf(other_words[i], sizeof(other_words[i]), "%sx", english[i]);
+        other[i] = other_words[i];
+    }
+    void* lists[4] = { NULL, NULL, NULL, NULL };
+    uint8_t* images[3];
+    const char* const* sources[3] = { other, reversed, english };
+    for (int i = 0; i < 3; i++) {
+        size_t image_len = bip39_wordlist_write_image(sources[i], NULL, 0);
+        images[i] = alloc_uint8_buffer(image_len, 0);
+        assert(bip39_wordlist_write_image(sources[i], images[i], image_len) == image_len);
+        lists[i] = bip39_wordlist_from_image(images[i], image_len);
+        assert(lists[i] != NULL);
+    }
+    // lists[3] stays NULL: the built-in English list.
+
+    const char* phrase = "legal winner thank year wave sausage worth useful legal winner thank yellow";
+    size_t ranking[4];
+    uint16_t words[24];
+    size_t words_len;
+    assert(bip39_detect_wordlist((const void* const*)lists, 4, phrase, strlen(phrase), ranking, words, &words_len) == 2);
+    assert(ranking[0] == 2 && ranking[1] == 3 && ranking[3] == 0);
+    assert(words_len == 12 && words[0] == 1019 && words[11] == 2040);
+
+    // Only the reversed list is left, and it fails the checksum.
+    assert(bip39_detect_wordlist((const void* const*)lists, 2, phrase, strlen(phrase), ranking, words, &words_len) == 0);
+    assert(ranking[0] == 1 && words_len == 0);
+
+    // Short prefixes are ranked without a checksum.
+    const char* other_phrase = "legalx\u3000winnerx";
+    assert(bip39_detect_wordlist((const void* const*)lists, 4, other_phrase, strlen(other_phrase), ranking, NULL, &words_len) == 1);
+    assert(ranking[0] == 0 && words_len == 2);
+    assert(bip39_detect_wordlist((const void* const*)lists, 4, "nothing fitz here", 17, ranking, words, &words_len) == 0);
+
+    // Thirteen words have no checksum layout, so no list fits them.
+    const char* thirteen = "legal winner thank year wave sausage worth useful legal winner thank yellow legal";
+    assert(bip39_detect_wordlist((const void* const*)lists, 4, thirteen, strlen(thirteen), ranking, words, &words_len) == 0);
+    assert(ranking[3] == 0 && words_len == 0);
+    assert(bip39_detect_wordlist((const void* const*)lists, 4, "", 0, NULL, NULL, &words_len) == 0);
+
+    for (int i = 0; i < 3; i++) {
+        bip39_wordlist_close(lists[i]);
+        free(images[i]);
+    }
+}
+
+static void test_context_pool() {
+    // More contexts than the locked pool holds, so some spill into large
+    // slots and some come from the heap.
+    size_t count = 128;
+    void* contexts[count];
+    uint8_t bytes[16];
+    memset(bytes, 0xA5, sizeof(bytes));
+    for (size_t i = 0; i < count; i++) {
+        contexts[i] = bip39_new_context();
+        assert(bip39_get_word_count(contexts[i]) == 24);
+        bip39_set_bytes(contexts[i], bytes, sizeof(bytes));
+    }
+    for (size_t i = 0; i < count; i++) {
+        bip39_dispose_context(contexts[i]);
+    }
+    for (size_t i = 0; i < count; i++) {
+        contexts[i] = bip39_new_context();
+        uint8_t zero[16] = { 0 };
+        assert(memcmp(bip39_get_bytes(contexts[i]), zero, sizeof(zero)) == 0);
+    }
+    for (size_t i = 0; i < count; i++) {
+        bip39_dispose_context(contexts[i]);
+    }
+}
+
+static void test_standard_sizes() {
+    // The size-specialized codecs must agree with the generic context path.
+    void* ctx = bip39_new_context();
+    for (size_t secret_len = 16; secret_len <= 32; secret_len += 4) {
+        for (int n = 0; n < 100; n++) {
+            uint8_t secret[32];
+            for (size_t i = 0; i < secret_len; i++) {
+                secret[i] = rand();
+            }
+
+            uint16_t words[24];
+            size_t words_len = bip39_words_from_secret(secret, secret_len, words, 24);
+            assert(words_len == secret_len * 3 / 4);
+
+            bip39_set_byte_count(ctx, secret_len);
+            bip39_set_payload(ctx, secret_len, secret);
+            for (size_t i = 0; i < words_len; i++) {
+                assert(words[i] == bip39_get_word(ctx, i));
+            }
+
+            char mnemonics[300];
+            assert(bip39_mnemonics_from_secret(secret, secret_len, mnemonics, sizeof(mnemonics)) > 0);
+            uint8_t decoded[32];
+            assert(bip39_secret_from_mnemonics(mnemonics, decoded, sizeof(decoded)) == secret_len);
+            assert(memcmp(decoded, secret, secret_len) == 0);
+
+            // Flip one entropy bit of the last word; both paths must agree on
+            // whether the checksum still holds.
+            words[words_len - 1] ^= 1 << (secret_len / 4);
+            char* last = strrchr(mnemonics, ' ') + 1;
+            bip39_mnemonic_from_word(words[words_len - 1], last);
+            bip39_set_word_count(ctx, words_len);
+            for (size_t i = 0; i < words_len; i++) {
+                bip39_set_word(ctx, i, words[i]);
+            }
+            bool valid = bip39_verify_checksum(ctx);
+            assert((bip39_secret_from_mnemonics(mnemonics, decoded, sizeof(decoded)) != 0) == valid);
+        }
+    }
+
+    uint16_t words[12];
+    uint8_t secret[16] = { 0 };
+    assert(bip39_words_from_secret(secret, 16, words, 6) == 12);
+    bip39_dispose_context(ctx);
+}
+
+static void test_kernel_dispatch() {
+    const char* name = bip39_kernel_name();
+    assert(strcmp(name, "scalar") == 0 || strcmp(name, "bmi2") == 0 || strcmp(name, "avx2") == 0);
+    assert(bip39_kernel_self_test(1000));
+}
+
 int main() {
     test_mnemonic_from_word();
     test_word_from_mnemonic();
     test_seed_from_string();
+    test_seed_stream();
     test_mnemonics_from_secret();
+    test_emit_words();
     test_secret_from_mnemonics();
+    test_length_delimited();
+    test_strict_parse();
+    test_abbreviations();
+    test_constant_time_lookup();
+    test_seedqr();
+    test_kway_search();
+    test_keypad_search();
+    test_valid_final_words();
+    test_scan();
+    test_scan_files();
+    test_generate();
+    test_seed_from_mnemonics();
+    test_master_key();
+    test_bip85();
+    test_recover_order();
+    test_seed_queue();
+    test_seed_cache();
+    test_entropy_set();
+    test_wordlist_image();
+    test_detect_wordlist();
+    test_context_pool();
+    test_standard_sizes();
+    test_kernel_dispatch();
 }
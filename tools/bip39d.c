@@ -0,0 +1,541 @@
+//
+//  bip39d.c
+//
+//  Copyright © 2020 by Blockchain Commons, LLC
+//  Licensed under the "BSD-2-Clause Plus Patent License"
+//
+
+// A small daemon that keeps phrase handling out of application processes.
+// Clients connect to a Unix domain socket and exchange frames:
+//
+//   request:  id (u32) | op (u8) | flags (u8, zero) | length (u16) | payload
+//   response: id (u32) | op (u8) | status (u8)      | length (u16) | payload
+//
+// All integers are big-endian. Requests on one connection may be pipelined;
+// responses carry the request id and arrive in completion order.
+//
+//   ENCODE    secret bytes             -> mnemonic text
+//   DECODE    mnemonic text            -> secret bytes
+//   VALIDATE  mnemonic text            -> empty (status tells)
+//   SEED      mnemonic text [NUL pass] -> 64-byte seed
+//
+// Encode, decode and validate are answered inline. Every SEED frame read in
+// one pass of the event loop is handed to the seed queue together, so its
+// worker threads run the PBKDF2 rounds for concurrent clients in parallel.
+
+#include "../src/bc-bip39.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/prctl.h>
+#endif
+
+#include <bc-crypto-base/bc-crypto-base.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+#define OP_ENCODE 1
+#define OP_DECODE 2
+#define OP_VALIDATE 3
+#define OP_SEED 4
+
+#define STATUS_OK 0
+#define STATUS_INVALID 1
+#define STATUS_BAD_REQUEST 2
+#define STATUS_BUSY 3
+
+#define HEADER_LEN 8
+#define MAX_PAYLOAD_LEN 0xFFFF
+#define MAX_SECRET_LEN 32
+#define MAX_MNEMONICS_LEN (24 * 9)
+
+// A client is read from at most one maximal frame ahead of the frames
+// answered, and frames are not answered while its unread responses exceed
+// OUT_HIGH_WATER, so a client that stops reading is not read from either.
+#define MAX_IN_LEN (HEADER_LEN + MAX_PAYLOAD_LEN)
+#define OUT_HIGH_WATER (1 << 20)
+
+typedef struct buffer_t {
+    uint8_t* bytes;
+    size_t len;
+    size_t cap;
+} buffer;
+
+struct client_t;
+
+typedef struct pending_seed_t {
+    struct pending_seed_t* next;
+    struct client_t* owner;
+    uint64_t job_id;
+    uint32_t request_id;
+} pending_seed;
+
+typedef struct client_t {
+    struct client_t* next;
+    int fd;
+    bool read_closed;
+    // Set when a buffer for this client cannot be grown; the client is
+    // dropped at the end of the loop pass.
+    bool failed;
+    buffer in;
+    buffer out;
+    pending_seed* seeds;
+} client;
+
+static volatile sig_atomic_t stopping = 0;
+
+// Seed jobs whose client has gone, kept until their completion arrives or
+// the daemon exits.
+static pending_seed* orphans = NULL;
+
+// Frame payloads are copied here, NUL-terminated, while they are handled.
+static char text[MAX_PAYLOAD_LEN + 1];
+
+static void on_signal(int sig) {
+    stopping = 1;
+}
+
+static bool buffer_reserve(buffer* b, size_t len) {
+    if (b->len + len <= b->cap) {
+        return true;
+    }
+    size_t cap = b->cap == 0 ? 4096 : b->cap;
+    while (cap < b->len + len) {
+        cap *= 2;
+    }
+    uint8_t* bytes = malloc(cap);
+    if (bytes == NULL) {
+        return false;
+    }
+    if (b->len > 0) {
+        memcpy(bytes, b->bytes, b->len);
+    }
+    if (b->bytes != NULL) {
+        memzero(b->bytes, b->cap);
+        free(b->bytes);
+    }
+    b->bytes = bytes;
+    b->cap = cap;
+    return true;
+}
+
+static void buffer_consume(buffer* b, size_t len) {
+    b->len -= len;
+    memmove(b->bytes, b->bytes + len, b->len);
+    memzero(b->bytes + b->len, len);
+}
+
+static void buffer_free(buffer* b) {
+    if (b->bytes != NULL) {
+        memzero(b->bytes, b->cap);
+        free(b->bytes);
+    }
+    memset(b, 0, sizeof(buffer));
+}
+
+static void respond(client* c, uint32_t id, uint8_t op, uint8_t status, const uint8_t* payload, size_t len) {
+    if (c->failed || !buffer_reserve(&c->out, HEADER_LEN + len)) {
+        c->failed = true;
+        return;
+    }
+    uint8_t* h = c->out.bytes + c->out.len;
+    h[0] = id >> 24;
+    h[1] = id >> 16;
+    h[2] = id >> 8;
+    h[3] = id;
+    h[4] = op;
+    h[5] = status;
+    h[6] = len >> 8;
+    h[7] = len;
+    if (len > 0) {
+        memcpy(h + HEADER_LEN, payload, len);
+    }
+    c->out.len += HEADER_LEN + len;
+}
+
+static void unlink_seed(pending_seed** list, pending_seed* p) {
+    for (pending_seed** link = list; *link != NULL; link = &(*link)->next) {
+        if (*link == p) {
+            *link = p->next;
+            return;
+        }
+    }
+}
+
+static void seed_done(uint64_t job_id, int status, const uint8_t* seed, void* user_data) {
+    pending_seed* p = user_data;
+    client* c = p->owner;
+    if (c == NULL) {
+        unlink_seed(&orphans, p);
+    } else {
+        unlink_seed(&c->seeds, p);
+        if (status == BIP39_SEED_OK) {
+            respond(c, p->request_id, OP_SEED, STATUS_OK, seed, BIP39_MNEMONIC_SEED_LEN);
+        } else {
+            respond(c, p->request_id, OP_SEED, STATUS_BUSY, NULL, 0);
+        }
+    }
+    free(p);
+}
+
+static void handle_encode(client* c, uint32_t id, const uint8_t* payload, size_t len) {
+    char mnemonics[MAX_MNEMONICS_LEN];
+    size_t mnemonics_len = 0;
+    if (len <= MAX_SECRET_LEN) {
+        mnemonics_len = bip39_mnemonics_from_secret(payload, len, mnemonics, sizeof(mnemonics));
+    }
+    if (mnemonics_len == 0) {
+        respond(c, id, OP_ENCODE, STATUS_INVALID, NULL, 0);
+    } else {
+        respond(c, id, OP_ENCODE, STATUS_OK, (const uint8_t*)mnemonics, mnemonics_len);
+    }
+    memzero(mnemonics, sizeof(mnemonics));
+}
+
+static void handle_decode(client* c, uint32_t id, uint8_t op, const char* mnemonics) {
+    uint8_t secret[MAX_SECRET_LEN];
+    size_t secret_len = bip39_secret_from_mnemonics(mnemonics, secret, sizeof(secret));
+    if (secret_len == 0) {
+        respond(c, id, op, STATUS_INVALID, NULL, 0);
+    } else if (op == OP_DECODE) {
+        respond(c, id, op, STATUS_OK, secret, secret_len);
+    } else {
+        respond(c, id, op, STATUS_OK, NULL, 0);
+    }
+    memzero(secret, sizeof(secret));
+}
+
+static void handle_seed(void* queue, client* c, uint32_t id, const char* text, size_t len) {
+    // The passphrase, if any, follows the first NUL.
+    size_t mnemonics_len = strlen(text);
+    const char* passphrase = mnemonics_len < len ? text + mnemonics_len + 1 : "";
+
+    pending_seed* p = calloc(sizeof(pending_seed), 1);
+    if (p == NULL) {
+        respond(c, id, OP_SEED, STATUS_BUSY, NULL, 0);
+        return;
+    }
+    p->owner = c;
+    p->request_id = id;
+    p->job_id = bip39_submit_seed(queue, text, passphrase, seed_done, p);
+    if (p->job_id == 0) {
+        free(p);
+        respond(c, id, OP_SEED, STATUS_BUSY, NULL, 0);
+        return;
+    }
+    p->next = c->seeds;
+    c->seeds = p;
+}
+
+// Answers every complete frame in the client's input buffer.
+static void handle_frames(void* queue, client* c) {
+    size_t used = 0;
+    while (!c->failed && c->in.len - used >= HEADER_LEN && c->out.len < OUT_HIGH_WATER) {
+        const uint8_t* h = c->in.bytes + used;
+        uint32_t id = (uint32_t)h[0] << 24 | (uint32_t)h[1] << 16 | (uint32_t)h[2] << 8 | h[3];
+        uint8_t op = h[4];
+        uint8_t flags = h[5];
+        size_t len = (size_t)h[6] << 8 | h[7];
+        if (c->in.len - used < HEADER_LEN + len) {
+            break;
+        }
+        const uint8_t* payload = h + HEADER_LEN;
+        used += HEADER_LEN + len;
+
+        memcpy(text, payload, len);
+        text[len] = '\0';
+
+        switch (flags == 0 ? op : 0) {
+            case OP_ENCODE:
+                handle_encode(c, id, payload, len);
+                break;
+            case OP_DECODE:
+            case OP_VALIDATE:
+                handle_decode(c, id, op, text);
+                break;
+            case OP_SEED:
+                handle_seed(queue, c, id, text, len);
+                break;
+            default:
+                respond(c, id, op, STATUS_BAD_REQUEST, NULL, 0);
+                break;
+        }
+        memzero(text, len);
+    }
+    buffer_consume(&c->in, used);
+}
+
+static bool read_client(client* c) {
+    while (c->in.len < MAX_IN_LEN) {
+        if (!buffer_reserve(&c->in, 4096)) {
+            c->failed = true;
+            return true;
+        }
+        size_t room = c->in.cap - c->in.len;
+        if (room > MAX_IN_LEN - c->in.len) {
+            room = MAX_IN_LEN - c->in.len;
+        }
+        ssize_t n = read(c->fd, c->in.bytes + c->in.len, room);
+        if (n > 0) {
+            c->in.len += n;
+        } else if (n == 0) {
+            c->read_closed = true;
+            return true;
+        } else if (errno == EINTR) {
+            continue;
+        } else {
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+    }
+    return true;
+}
+
+static bool write_client(client* c) {
+    while (c->out.len > 0) {
+        ssize_t n = send(c->fd, c->out.bytes, c->out.len, MSG_NOSIGNAL);
+        if (n > 0) {
+            buffer_consume(&c->out, n);
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else {
+            return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+        }
+    }
+    return true;
+}
+
+static void close_client(void* queue, client* c) {
+    // Jobs still queued are cancelled; their completions find no owner.
+    while (c->seeds != NULL) {
+        pending_seed* p = c->seeds;
+        c->seeds = p->next;
+        p->owner = NULL;
+        p->next = orphans;
+        orphans = p;
+        bip39_cancel_seed(queue, p->job_id);
+    }
+    close(c->fd);
+    buffer_free(&c->in);
+    buffer_free(&c->out);
+    free(c);
+}
+
+static int listen_on(const char* path) {
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "bip39d: socket path too long\n");
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+
+    struct stat st;
+    if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode)) {
+        unlink(path);
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        perror("bip39d: socket");
+        return -1;
+    }
+    // Only the owner may connect.
+    mode_t mask = umask(0077);
+    int result = bind(fd, (struct sockaddr*)&addr, sizeof(addr));
+    umask(mask);
+    if (result != 0 || listen(fd, 64) != 0) {
+        perror("bip39d: bind");
+        close(fd);
+        return -1;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    return fd;
+}
+
+static void accept_clients(int listen_fd, client** clients) {
+    for (;;) {
+        int fd = accept(listen_fd, NULL, NULL);
+        if (fd < 0) {
+            return;
+        }
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+        client* c = calloc(sizeof(client), 1);
+        if (c == NULL) {
+            close(fd);
+            continue;
+        }
+        c->fd = fd;
+        c->next = *clients;
+        *clients = c;
+    }
+}
+
+static void usage() {
+    fprintf(stderr, "usage: bip39d [-t threads] [-j max_jobs] socket-path\n");
+}
+
+int main(int argc, char** argv) {
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    long max_jobs = 256;
+    int opt;
+    while ((opt = getopt(argc, argv, "t:j:")) != -1) {
+        switch (opt) {
+            case 't':
+                threads = strtol(optarg, NULL, 10);
+                break;
+            case 'j':
+                max_jobs = strtol(optarg, NULL, 10);
+                break;
+            default:
+                usage();
+                return 1;
+        }
+    }
+    if (optind != argc - 1 || threads < 1 || max_jobs < 1) {
+        usage();
+        return 1;
+    }
+    const char* path = argv[optind];
+
+#if defined(__linux__)
+    // Keep secrets out of core dumps and away from ptrace by other users.
+    prctl(PR_SET_DUMPABLE, 0);
+#endif
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    int listen_fd = listen_on(path);
+    if (listen_fd < 0) {
+        return 1;
+    }
+    void* queue = bip39_new_seed_queue(threads, max_jobs);
+    if (queue == NULL) {
+        fprintf(stderr, "bip39d: cannot start seed queue\n");
+        close(listen_fd);
+        unlink(path);
+        return 1;
+    }
+
+    client* clients = NULL;
+    struct pollfd* fds = NULL;
+    size_t fds_cap = 0;
+
+    while (!stopping) {
+        size_t clients_len = 0;
+        for (client* c = clients; c != NULL; c = c->next) {
+            clients_len++;
+        }
+        if (fds_cap < clients_len + 2) {
+            struct pollfd* grown = realloc(fds, (clients_len + 2) * 2 * sizeof(struct pollfd));
+            if (grown == NULL) {
+                fprintf(stderr, "bip39d: out of memory\n");
+                break;
+            }
+            fds = grown;
+            fds_cap = (clients_len + 2) * 2;
+        }
+        fds[0].fd = listen_fd;
+        fds[0].events = POLLIN;
+        fds[1].fd = bip39_seed_queue_fd(queue);
+        fds[1].events = POLLIN;
+        size_t i = 2;
+        for (client* c = clients; c != NULL; c = c->next, i++) {
+            // A client that has stopped sending and has nothing to receive
+            // is left out of the poll: a hung-up socket would report
+            // POLLHUP on every pass while its seeds are derived. The queue's
+            // descriptor wakes the loop when they complete.
+            fds[i].fd = c->read_closed && c->out.len == 0 ? -1 : c->fd;
+            fds[i].events = 0;
+            if (!c->read_closed && c->in.len < MAX_IN_LEN && c->out.len < OUT_HIGH_WATER) {
+                fds[i].events |= POLLIN;
+            }
+            if (c->out.len > 0) {
+                fds[i].events |= POLLOUT;
+            }
+        }
+
+        if (poll(fds, i, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("bip39d: poll");
+            break;
+        }
+
+        // Read and answer every ready client before looking at completions,
+        // so seed requests that arrived together are queued together. Frames
+        // held back while a client's responses piled up are answered once
+        // they drain.
+        i = 2;
+        for (client* c = clients; c != NULL; c = c->next, i++) {
+            if (!c->read_closed && (fds[i].revents & (POLLIN | POLLHUP | POLLERR))) {
+                if (!read_client(c)) {
+                    c->read_closed = true;
+                    c->out.len = 0;
+                }
+            }
+            if (c->in.len > 0) {
+                handle_frames(queue, c);
+            }
+        }
+        if (fds[1].revents & POLLIN) {
+            bip39_poll_seeds(queue, SIZE_MAX);
+        }
+
+        client** link = &clients;
+        while (*link != NULL) {
+            client* c = *link;
+            bool ok = !c->failed && write_client(c);
+            if (!ok || (c->read_closed && c->out.len == 0 && c->seeds == NULL)) {
+                *link = c->next;
+                close_client(queue, c);
+            } else {
+                link = &c->next;
+            }
+        }
+
+        if (fds[0].revents & POLLIN) {
+            accept_clients(listen_fd, &clients);
+        }
+    }
+
+    while (clients != NULL) {
+        client* c = clients;
+        clients = c->next;
+        close_client(queue, c);
+    }
+    bip39_poll_seeds(queue, SIZE_MAX);
+    bip39_dispose_seed_queue(queue);
+    // Jobs that were still running never complete now.
+    while (orphans != NULL) {
+        pending_seed* p = orphans;
+        orphans = p->next;
+        free(p);
+    }
+    free(fds);
+    close(listen_fd);
+    unlink(path);
+
+    return 0;
+}
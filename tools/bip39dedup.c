@@ -0,0 +1,138 @@
+//
+//  bip39dedup.c
+//
+//  Copyright © 2020 by Blockchain Commons, LLC
+//  Licensed under the "BSD-2-Clause Plus Patent License"
+//
+
+// Finds phrases that share a secret. Input files hold one phrase per line.
+// With one file, prints a line for each secret that occurs more than once,
+// listing the line numbers it occurs on. With two files, prints a line for
+// each secret found in both, as the line numbers in the first file, a
+// colon, then the line numbers in the second. Lines that are not valid
+// phrases are counted and reported on stderr. Secrets are never printed.
+
+#include "../src/bc-bip39.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/prctl.h>
+#endif
+
+static bool load(void* set, const char* path) {
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        perror(path);
+        return false;
+    }
+    char* line = NULL;
+    size_t line_cap = 0;
+    ssize_t line_len;
+    uint64_t line_number = 0;
+    uint64_t invalid = 0;
+    while ((line_len = getline(&line, &line_cap, f)) >= 0) {
+        line_number++;
+        bool blank = strspn(line, " \t\r\n") == (size_t)line_len;
+        if (!blank && !bip39_entropy_set_add(set, line, line_len, line_number)) {
+            invalid++;
+        }
+        memset(line, 0, line_len);
+    }
+    free(line);
+    bool ok = !ferror(f);
+    fclose(f);
+    if (!ok) {
+        fprintf(stderr, "bip39dedup: error reading %s\n", path);
+    } else if (!bip39_entropy_set_ok(set)) {
+        fprintf(stderr, "bip39dedup: cannot write temporary files\n");
+        ok = false;
+    } else if (invalid > 0) {
+        fprintf(stderr, "bip39dedup: %s: %" PRIu64 " invalid phrases\n", path, invalid);
+    }
+    return ok;
+}
+
+static void print_ids(const uint64_t* ids, size_t ids_len) {
+    for (size_t i = 0; i < ids_len; i++) {
+        printf(i == 0 ? "%" PRIu64 : " %" PRIu64, ids[i]);
+    }
+}
+
+static void print_group(const uint64_t* ids_a, size_t ids_a_len, const uint64_t* ids_b, size_t ids_b_len, void* user_data) {
+    print_ids(ids_a, ids_a_len);
+    if (ids_b != NULL) {
+        printf(" : ");
+        print_ids(ids_b, ids_b_len);
+    }
+    printf("\n");
+}
+
+static void usage() {
+    fprintf(stderr, "usage: bip39dedup [-m megabytes] [-t threads] [-d spill-dir] file [other-file]\n");
+}
+
+int main(int argc, char** argv) {
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    long megabytes = 256;
+    const char* spill_dir = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "m:t:d:")) != -1) {
+        switch (opt) {
+            case 'm':
+                megabytes = strtol(optarg, NULL, 10);
+                break;
+            case 't':
+                threads = strtol(optarg, NULL, 10);
+                break;
+            case 'd':
+                spill_dir = optarg;
+                break;
+            default:
+                usage();
+                return 1;
+        }
+    }
+    int files = argc - optind;
+    if (files < 1 || files > 2 || threads < 1 || megabytes < 1) {
+        usage();
+        return 1;
+    }
+
+#if defined(__linux__)
+    prctl(PR_SET_DUMPABLE, 0);
+#endif
+
+    // The budget is split evenly between the sets.
+    size_t budget = (size_t)megabytes * 1024 * 1024 / files;
+    void* sets[2] = { NULL, NULL };
+    bool ok = true;
+    for (int i = 0; i < files && ok; i++) {
+        sets[i] = bip39_new_entropy_set(budget, threads, spill_dir);
+        ok = sets[i] != NULL && load(sets[i], argv[optind + i]);
+    }
+    if (ok) {
+        if (files == 1) {
+            bip39_find_duplicates(sets[0], print_group, NULL);
+        } else {
+            bip39_find_shared(sets[0], sets[1], print_group, NULL);
+        }
+        for (int i = 0; i < files; i++) {
+            if (!bip39_entropy_set_ok(sets[i])) {
+                fprintf(stderr, "bip39dedup: out of memory\n");
+                ok = false;
+                break;
+            }
+        }
+    }
+    for (int i = 0; i < files; i++) {
+        if (sets[i] != NULL) {
+            bip39_dispose_entropy_set(sets[i]);
+        }
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+//
+//  bip39scan.c
+//
+//  Copyright © 2020 by Blockchain Commons, LLC
+//  Licensed under the "BSD-2-Clause Plus Patent License"
+//
+
+// Scans files for leaked phrases: runs of 12, 15, 18, 21 or 24 BIP39 words
+// with a valid checksum. Files are scanned in parallel, one per thread.
+// Prints a line for each phrase as the path, byte offset and byte length
+// followed by the number of words; the words themselves are never printed.
+// Exits with 1 if any phrase was found and 2 if a file could not be read,
+// so it can gate a pipeline like grep.
+
+#include "../src/bc-bip39.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/prctl.h>
+#endif
+
+typedef struct scan_output_t {
+    const char* const* paths;
+    size_t found;
+} scan_output;
+
+static void print_phrase(size_t path, size_t offset, size_t length, const uint16_t* words, size_t words_len, void* user_data) {
+    scan_output* out = user_data;
+    printf("%s:%zu:%zu: %zu words\n", out->paths[path], offset, length, words_len);
+    out->found++;
+}
+
+static void usage() {
+    fprintf(stderr, "usage: bip39scan [-t threads] file...\n");
+}
+
+int main(int argc, char** argv) {
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    int opt;
+    while ((opt = getopt(argc, argv, "t:")) != -1) {
+        switch (opt) {
+            case 't':
+                threads = strtol(optarg, NULL, 10);
+                break;
+            default:
+                usage();
+                return 2;
+        }
+    }
+    if (optind >= argc || threads < 1) {
+        usage();
+        return 2;
+    }
+
+#if defined(__linux__)
+    prctl(PR_SET_DUMPABLE, 0);
+#endif
+
+    const char* const* paths = (const char* const*)(argv + optind);
+    size_t paths_len = argc - optind;
+    scan_output out = { paths, 0 };
+    size_t failed = bip39_scan_files(paths, paths_len, threads, print_phrase, &out);
+    if (failed > 0) {
+        fprintf(stderr, "bip39scan: %zu files could not be read\n", failed);
+        return 2;
+    }
+    return out.found > 0 ? 1 : 0;
+}
@@ -0,0 +1,169 @@
+//
+//  test-bip39d.c
+//
+//  Copyright © 2020 by Blockchain Commons, LLC
+//  Licensed under the "BSD-2-Clause Plus Patent License"
+//
+//  Starts bip39d on a temporary socket, pipelines one frame of each kind,
+//  and checks every response.
+//
+
+#include "../src/bc-bip39.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#define HEADER_LEN 8
+
+#define OP_ENCODE 1
+#define OP_DECODE 2
+#define OP_VALIDATE 3
+#define OP_SEED 4
+
+#define STATUS_OK 0
+#define STATUS_INVALID 1
+#define STATUS_BAD_REQUEST 2
+
+static const char* phrase = "legal winner thank year wave sausage worth useful legal winner thank yellow";
+
+typedef struct response_t {
+    uint8_t op;
+    uint8_t status;
+    size_t len;
+    uint8_t payload[256];
+    bool seen;
+} response;
+
+static void send_frame(int fd, uint32_t id, uint8_t op, uint8_t flags, const void* payload, size_t len) {
+    uint8_t frame[HEADER_LEN + 256];
+    frame[0] = id >> 24;
+    frame[1] = id >> 16;
+    frame[2] = id >> 8;
+    frame[3] = id;
+    frame[4] = op;
+    frame[5] = flags;
+    frame[6] = len >> 8;
+    frame[7] = len;
+    memcpy(frame + HEADER_LEN, payload, len);
+    assert(write(fd, frame, HEADER_LEN + len) == (ssize_t)(HEADER_LEN + len));
+}
+
+static void read_exactly(int fd, uint8_t* bytes, size_t len) {
+    while (len > 0) {
+        ssize_t n = read(fd, bytes, len);
+        assert(n > 0);
+        bytes += n;
+        len -= n;
+    }
+}
+
+static void read_responses(int fd, response* responses, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint8_t h[HEADER_LEN];
+        read_exactly(fd, h, HEADER_LEN);
+        uint32_t id = (uint32_t)h[0] << 24 | (uint32_t)h[1] << 16 | (uint32_t)h[2] << 8 | h[3];
+        assert(id < count && !responses[id].seen);
+        response* r = &responses[id];
+        r->op = h[4];
+        r->status = h[5];
+        r->len = (size_t)h[6] << 8 | h[7];
+        assert(r->len <= sizeof(r->payload));
+        read_exactly(fd, r->payload, r->len);
+        r->seen = true;
+    }
+}
+
+static int connect_to(const char* path) {
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    // Give the daemon up to five seconds to start listening.
+    for (int attempt = 0; attempt < 500; attempt++) {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        assert(fd >= 0);
+        if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) == 0) {
+            return fd;
+        }
+        close(fd);
+        struct timespec ts = { 0, 10 * 1000 * 1000 };
+        nanosleep(&ts, NULL);
+    }
+    return -1;
+}
+
+int main() {
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/bip39d-test-%d.sock", (int)getpid());
+
+    pid_t daemon = fork();
+    assert(daemon >= 0);
+    if (daemon == 0) {
+        execl("./bip39d", "bip39d", "-t", "2", path, (char*)NULL);
+        _exit(127);
+    }
+    int fd = connect_to(path);
+    assert(fd >= 0);
+
+    uint8_t secret[16];
+    memset(secret, 0x7f, sizeof(secret));
+    const char* bad_phrase = "legal winner thank year wave sausage worth useful legal winner thank thank";
+    char seed_request[128];
+    size_t phrase_len = strlen(phrase);
+    memcpy(seed_request, phrase, phrase_len + 1);
+    memcpy(seed_request + phrase_len + 1, "TREZOR", 6);
+
+    send_frame(fd, 0, OP_SEED, 0, seed_request, phrase_len + 1 + 6);
+    send_frame(fd, 1, OP_ENCODE, 0, secret, sizeof(secret));
+    send_frame(fd, 2, OP_DECODE, 0, phrase, phrase_len);
+    send_frame(fd, 3, OP_VALIDATE, 0, bad_phrase, strlen(bad_phrase));
+    send_frame(fd, 4, 99, 0, NULL, 0);
+    send_frame(fd, 5, OP_ENCODE, 1, secret, sizeof(secret));
+
+    response responses[6];
+    memset(responses, 0, sizeof(responses));
+    read_responses(fd, responses, 6);
+
+    uint8_t expected_seed[BIP39_MNEMONIC_SEED_LEN];
+    bip39_seed_from_mnemonics(phrase, "TREZOR", expected_seed);
+    assert(responses[0].op == OP_SEED && responses[0].status == STATUS_OK);
+    assert(responses[0].len == BIP39_MNEMONIC_SEED_LEN && memcmp(responses[0].payload, expected_seed, BIP39_MNEMONIC_SEED_LEN) == 0);
+
+    assert(responses[1].op == OP_ENCODE && responses[1].status == STATUS_OK);
+    assert(responses[1].len == phrase_len && memcmp(responses[1].payload, phrase, phrase_len) == 0);
+
+    assert(responses[2].op == OP_DECODE && responses[2].status == STATUS_OK);
+    assert(responses[2].len == sizeof(secret) && memcmp(responses[2].payload, secret, sizeof(secret)) == 0);
+
+    assert(responses[3].op == OP_VALIDATE && responses[3].status == STATUS_INVALID && responses[3].len == 0);
+    assert(responses[4].status == STATUS_BAD_REQUEST);
+    assert(responses[5].status == STATUS_BAD_REQUEST);
+
+    close(fd);
+
+    // A client that stops sending still gets its seed once it is derived.
+    fd = connect_to(path);
+    assert(fd >= 0);
+    send_frame(fd, 0, OP_SEED, 0, seed_request, phrase_len + 1 + 6);
+    assert(shutdown(fd, SHUT_WR) == 0);
+    memset(responses, 0, sizeof(responses));
+    read_responses(fd, responses, 1);
+    assert(responses[0].status == STATUS_OK && memcmp(responses[0].payload, expected_seed, BIP39_MNEMONIC_SEED_LEN) == 0);
+    close(fd);
+
+    kill(daemon, SIGTERM);
+    int status;
+    assert(waitpid(daemon, &status, 0) == daemon);
+    assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    assert(access(path, F_OK) != 0);
+    return 0;
+}